@@ -19,6 +19,12 @@ namespace MemOrder {
   static constexpr i32 SEQ_CST = __ATOMIC_SEQ_CST;
 }
 
+//---
+static inline void atomic_fence(i32 mem_order = MemOrder::SEQ_CST)
+{
+  __atomic_thread_fence(mem_order);
+}
+
 //---
 template <typename T = u32>
 struct Atomic
@@ -60,6 +66,32 @@ struct Atomic
                   i32 mem_order = MemOrder::SEQ_CST);
 };
 
+//---
+struct Atomic128
+{
+  //---
+  struct alignas(16) Value
+  {
+    u64 _low;
+    u64 _high;
+  };
+
+  //---
+  volatile Value _value;
+
+  //---
+  DISALLOW_COPY(Atomic128);
+  Atomic128();
+  explicit Atomic128(const Value value);
+  ~Atomic128();
+
+  //---
+  void store(const Value value);
+  Value load();
+  bool compare_and_swap(Value& expected_value,
+                        const Value value_if_expected);
+};
+
 //---
 struct AtomicFlag
 {
@@ -0,0 +1,44 @@
+/*
+  Documentation: https://www.path.blog/docs/thread.html
+*/
+
+#pragma once
+#include "pathlib/types/types.h"
+#include "pathlib/concurrency/atomic.h"
+#include "pathlib/concurrency/parking.h"
+
+namespace Pathlib {
+
+//---
+struct Barrier
+{
+  //---
+  alignas(CACHE_LINE_SIZE) Atomic<u32> _arrived;
+  Atomic<u32> _phase;
+  u32 _thread_count;
+
+  //---
+  DISALLOW_COPY(Barrier);
+  explicit Barrier(u32 thread_count)
+  {
+    _arrived.store(0);
+    _phase.store(0);
+    _thread_count = thread_count;
+  }
+  ~Barrier() {}
+
+  //---
+  inline bool arrive_and_wait()
+  {
+    u32 phase = _phase.load(MemOrder::ACQUIRE);
+    if (_arrived.fetch_add(1, MemOrder::ACQ_REL) == _thread_count) {
+      _arrived.store(0, MemOrder::RELAXED);
+      _phase.fetch_add(1, MemOrder::RELEASE);
+      Win32::wake_by_address_all((void*)&_phase._value);
+      return true;
+    }
+    _Internal::wait_while_equal(_phase, phase);
+    return false;
+  }
+};
+}
\ No newline at end of file
@@ -0,0 +1,21 @@
+/*
+  Documentation: https://www.path.blog/docs/thread.html
+*/
+
+#pragma once
+#include "pathlib/types/types.h"
+
+namespace Pathlib {
+
+//---
+template <typename T>
+struct alignas(CACHE_LINE_SIZE) CachePadded
+{
+  //---
+  T _value;
+
+  //---
+  inline T& operator *() { return _value; }
+  inline T* operator ->() { return &_value; }
+};
+}
\ No newline at end of file
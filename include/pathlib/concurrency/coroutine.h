@@ -0,0 +1,97 @@
+/*
+  Documentation: https://www.path.blog/docs/thread.html
+*/
+
+#pragma once
+#include "pathlib/types/types.h"
+
+/* The compiler looks up coroutine_traits and coroutine_handle in namespace std; pathlib has no
+   standard library, so the minimal set is declared here on top of the __builtin_coro intrinsics. */
+namespace std {
+
+//---
+template <typename R, typename... Args>
+struct coroutine_traits
+{
+  using promise_type = typename R::promise_type;
+};
+
+//---
+template <typename Promise = void>
+struct coroutine_handle;
+
+//---
+template <>
+struct coroutine_handle<void>
+{
+  //---
+  void* _frame = nullptr;
+
+  //---
+  constexpr coroutine_handle() noexcept {}
+  constexpr coroutine_handle(decltype(nullptr)) noexcept {}
+
+  //---
+  static constexpr coroutine_handle from_address(void* frame) noexcept
+  {
+    coroutine_handle handle;
+    handle._frame = frame;
+    return handle;
+  }
+
+  //---
+  constexpr void* address() const noexcept { return _frame; }
+  constexpr explicit operator bool() const noexcept { return (_frame != nullptr); }
+  bool done() const noexcept { return __builtin_coro_done(_frame); }
+  void resume() const { __builtin_coro_resume(_frame); }
+  void operator()() const { __builtin_coro_resume(_frame); }
+  void destroy() const { __builtin_coro_destroy(_frame); }
+};
+
+//---
+template <typename Promise>
+struct coroutine_handle : coroutine_handle<void>
+{
+  //---
+  static constexpr coroutine_handle from_address(void* frame) noexcept
+  {
+    coroutine_handle handle;
+    handle._frame = frame;
+    return handle;
+  }
+
+  //---
+  static coroutine_handle from_promise(Promise& promise) noexcept
+  {
+    return from_address(__builtin_coro_promise((void*)&promise, alignof(Promise), true));
+  }
+
+  //---
+  Promise& promise() const
+  {
+    return *(Promise*)__builtin_coro_promise(_frame, alignof(Promise), false);
+  }
+};
+
+//---
+inline coroutine_handle<> noop_coroutine() noexcept
+{
+  return coroutine_handle<>::from_address(__builtin_coro_noop());
+}
+
+//---
+struct suspend_always
+{
+  constexpr bool await_ready() const noexcept { return false; }
+  constexpr void await_suspend(coroutine_handle<>) const noexcept {}
+  constexpr void await_resume() const noexcept {}
+};
+
+//---
+struct suspend_never
+{
+  constexpr bool await_ready() const noexcept { return true; }
+  constexpr void await_suspend(coroutine_handle<>) const noexcept {}
+  constexpr void await_resume() const noexcept {}
+};
+}
\ No newline at end of file
@@ -0,0 +1,153 @@
+/*
+  Documentation: https://www.path.blog/docs/thread.html
+*/
+
+#pragma once
+#include "pathlib/types/types.h"
+#include "pathlib/math/math.h"
+#include "pathlib/concurrency/atomic.h"
+#include "pathlib/concurrency/cache_padded.h"
+
+namespace Pathlib {
+
+//---
+template <typename T,
+          u32 CAPACITY,
+          u32 MAX_CONSUMERS = 8>
+struct Disruptor
+{
+  static_assert(Math::is_pot(CAPACITY), "Disruptor CAPACITY must be a power of two.");
+
+  //---
+  static constexpr u64 NO_CONSUMER = Types::U64_MAX;
+  static constexpr u32 INVALID_CONSUMER = Types::U32_MAX;
+
+  //---
+  alignas(CACHE_LINE_SIZE) Atomic<u64> _cursor;
+  alignas(CACHE_LINE_SIZE) u64 _claimed;
+  u64 _cached_min_sequence;
+  CachePadded<Atomic<u64>> _consumer_sequences[MAX_CONSUMERS];
+  alignas(CACHE_LINE_SIZE) T _data[CAPACITY];
+
+  //---
+  DISALLOW_COPY(Disruptor);
+  Disruptor()
+  {
+    _cursor.store(0);
+    _claimed = 0;
+    _cached_min_sequence = 0;
+    for (u32 c = 0; c < MAX_CONSUMERS; ++c) {
+      _consumer_sequences[c]->store(NO_CONSUMER, MemOrder::RELAXED);
+    }
+  }
+  ~Disruptor() {}
+
+  //---
+  [[nodiscard]] u32 add_consumer()
+  {
+    /* Call on the producer thread, or before publishing starts: the producer's cached gate must not run past the new consumer. */
+    u64 start = _cursor.load(MemOrder::ACQUIRE);
+    for (u32 c = 0; c < MAX_CONSUMERS; ++c) {
+      if (_consumer_sequences[c]->compare_and_swap(NO_CONSUMER, start, MemOrder::ACQ_REL)) {
+        _cached_min_sequence = Math::min(_cached_min_sequence, start);
+        return c;
+      }
+    }
+    return INVALID_CONSUMER;
+  }
+
+  //---
+  void remove_consumer(u32 consumer)
+  {
+    _consumer_sequences[consumer]->store(NO_CONSUMER, MemOrder::RELEASE);
+  }
+
+  //---
+  [[nodiscard]] bool claim(u32 count,
+                           u64& sequence_out)
+  {
+    /* The slowest consumer gates the producer; its position is cached until the ring looks full. */
+    if (DONT_EXPECT((count == 0) || (count > CAPACITY))) {
+      return false;
+    }
+    if ((_claimed + count - _cached_min_sequence) > CAPACITY) {
+      _cached_min_sequence = get_min_sequence();
+      if ((_claimed + count - _cached_min_sequence) > CAPACITY) {
+        return false;
+      }
+    }
+    sequence_out = _claimed;
+    _claimed += count;
+    return true;
+  }
+
+  //---
+  void publish()
+  {
+    _cursor.store(_claimed, MemOrder::RELEASE);
+  }
+
+  //---
+  [[nodiscard]] bool push(const T& value)
+  {
+    u64 sequence;
+    if (!claim(1, sequence)) {
+      return false;
+    }
+    _data[sequence & (CAPACITY - 1)] = value;
+    publish();
+    return true;
+  }
+
+  //---
+  [[nodiscard]] u64 peek(u32 consumer,
+                         u64& sequence_out)
+  {
+    sequence_out = _consumer_sequences[consumer]->load(MemOrder::RELAXED);
+    return (_cursor.load(MemOrder::ACQUIRE) - sequence_out);
+  }
+
+  //---
+  void release(u32 consumer,
+               u64 count)
+  {
+    u64 sequence = _consumer_sequences[consumer]->load(MemOrder::RELAXED);
+    _consumer_sequences[consumer]->store(sequence + count, MemOrder::RELEASE);
+  }
+
+  //---
+  [[nodiscard]] bool pop(u32 consumer,
+                         T& value_out)
+  {
+    u64 sequence;
+    if (peek(consumer, sequence) == 0) {
+      return false;
+    }
+    value_out = _data[sequence & (CAPACITY - 1)];
+    release(consumer, 1);
+    return true;
+  }
+
+  //---
+  inline T& get(u64 sequence)
+  {
+    return _data[sequence & (CAPACITY - 1)];
+  }
+
+  //---
+  u64 get_min_sequence()
+  {
+    u64 min_sequence = _claimed;
+    for (u32 c = 0; c < MAX_CONSUMERS; ++c) {
+      min_sequence = Math::min(min_sequence, _consumer_sequences[c]->load(MemOrder::ACQUIRE));
+    }
+    return min_sequence;
+  }
+
+  //---
+  static constexpr u32 get_capacity()
+  {
+    return CAPACITY;
+  }
+};
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+/*
+  Documentation: https://www.path.blog/docs/thread.html
+*/
+
+#pragma once
+#include "pathlib/types/types.h"
+#include "pathlib/concurrency/atomic.h"
+#include "pathlib/concurrency/participant_registry.h"
+
+namespace Pathlib {
+
+//---
+typedef void(*ReclaimFunction)(void* ptr);
+
+namespace _Internal {
+
+//---
+struct Retired
+{
+  void* _ptr;
+  ReclaimFunction _function;
+  u64 _epoch;
+};
+
+//---
+struct Epochs
+{
+  //---
+  static constexpr u32 MAX_PARTICIPANTS = 512;
+  static constexpr u32 NOT_REGISTERED = Types::U32_MAX;
+  static constexpr u32 RECLAIM_INTERVAL = 64;
+  static constexpr u32 LIMBO_RESERVE_CAPACITY = 128;
+  static constexpr u64 ACTIVE = 1;
+
+  //---
+  struct alignas(CACHE_LINE_SIZE) Participant
+  {
+    Atomic<u64> _local_epoch;
+    Atomic<u32> _in_use;
+    u32 _depth;
+    u32 _retire_count;
+    u32 _limbo_count;
+    u32 _limbo_capacity;
+    Retired* _limbo;
+  };
+
+  //---
+  alignas(CACHE_LINE_SIZE) Atomic<u64> _global_epoch;
+  ParticipantRegistry<Participant, MAX_PARTICIPANTS> _registry;
+
+  //---
+  DISALLOW_COPY(Epochs);
+  Epochs();
+  ~Epochs();
+
+  //---
+  void enter();
+  void exit();
+  void retire(void* ptr,
+              ReclaimFunction function);
+  bool try_advance();
+  void flush();
+  void unregister_thread();
+
+  //---
+  Participant& get_participant();
+  void reclaim(Participant& participant);
+};
+}
+
+//---
+_Internal::Epochs& get_epochs();
+
+//---
+struct EpochGuard
+{
+  //---
+  DISALLOW_COPY(EpochGuard);
+  EpochGuard() { get_epochs().enter(); }
+  ~EpochGuard() { get_epochs().exit(); }
+};
+}
\ No newline at end of file
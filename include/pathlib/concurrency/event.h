@@ -0,0 +1,52 @@
+/*
+  Documentation: https://www.path.blog/docs/thread.html
+*/
+
+#pragma once
+#include "pathlib/types/types.h"
+#include "pathlib/concurrency/atomic.h"
+#include "pathlib/concurrency/parking.h"
+
+namespace Pathlib {
+
+//---
+struct Event
+{
+  //---
+  alignas(CACHE_LINE_SIZE) Atomic<u32> _signaled;
+
+  //---
+  DISALLOW_COPY(Event);
+  explicit Event(bool signaled = false)
+  {
+    _signaled.store(signaled ? 1 : 0);
+  }
+  ~Event() {}
+
+  //---
+  inline void set()
+  {
+    if (_signaled.swap(1, MemOrder::RELEASE) == 0) {
+      Win32::wake_by_address_all((void*)&_signaled._value);
+    }
+  }
+
+  //---
+  inline void reset()
+  {
+    _signaled.store(0, MemOrder::RELEASE);
+  }
+
+  //---
+  inline bool is_set()
+  {
+    return (_signaled.load(MemOrder::ACQUIRE) != 0);
+  }
+
+  //---
+  inline void wait()
+  {
+    _Internal::wait_while_equal(_signaled, 0);
+  }
+};
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+/*
+  Documentation: https://www.path.blog/docs/thread.html
+*/
+
+#pragma once
+#include "pathlib/types/types.h"
+#include "pathlib/concurrency/atomic.h"
+#include "pathlib/concurrency/participant_registry.h"
+#include "pathlib/concurrency/epoch.h"
+
+namespace Pathlib::_Internal {
+
+//---
+struct HazardPointers
+{
+  //---
+  static constexpr u32 MAX_PARTICIPANTS = 512;
+  static constexpr u32 HAZARDS_PER_THREAD = 4;
+  static constexpr u32 NOT_REGISTERED = Types::U32_MAX;
+  static constexpr u32 RETIRED_RESERVE_CAPACITY = 128;
+
+  //---
+  struct alignas(CACHE_LINE_SIZE) Participant
+  {
+    Atomic<u64> _hazards[HAZARDS_PER_THREAD];
+    Atomic<u32> _in_use;
+    u32 _retired_count;
+    u32 _retired_capacity;
+    Retired* _retired;
+  };
+
+  //---
+  ParticipantRegistry<Participant, MAX_PARTICIPANTS> _registry;
+
+  //---
+  DISALLOW_COPY(HazardPointers);
+  HazardPointers();
+  ~HazardPointers();
+
+  //---
+  void* protect(u32 hazard_index,
+                Atomic<u64>& source);
+  void clear(u32 hazard_index);
+  void retire(void* ptr,
+              ReclaimFunction function);
+  void flush();
+  void unregister_thread();
+
+  //---
+  Participant& get_participant();
+  bool is_hazardous(void* ptr);
+  void scan(Participant& participant);
+};
+}
+
+//---
+namespace Pathlib { _Internal::HazardPointers& get_hazard_pointers(); }
\ No newline at end of file
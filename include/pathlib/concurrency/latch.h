@@ -0,0 +1,57 @@
+/*
+  Documentation: https://www.path.blog/docs/thread.html
+*/
+
+#pragma once
+#include "pathlib/types/types.h"
+#include "pathlib/concurrency/atomic.h"
+#include "pathlib/concurrency/parking.h"
+
+namespace Pathlib {
+
+//---
+struct Latch
+{
+  //---
+  alignas(CACHE_LINE_SIZE) Atomic<u32> _count;
+
+  //---
+  DISALLOW_COPY(Latch);
+  explicit Latch(u32 count)
+  {
+    _count.store(count);
+  }
+  ~Latch() {}
+
+  //---
+  inline void count_down(u32 count = 1)
+  {
+    if (_count.fetch_sub(count, MemOrder::RELEASE) == 0) {
+      Win32::wake_by_address_all((void*)&_count._value);
+    }
+  }
+
+  //---
+  inline bool is_done()
+  {
+    return (_count.load(MemOrder::ACQUIRE) == 0);
+  }
+
+  //---
+  inline void wait()
+  {
+    u32 count = _count.load(MemOrder::ACQUIRE);
+    while (count != 0) {
+      _Internal::wait_while_equal(_count, count);
+      count = _count.load(MemOrder::ACQUIRE);
+    }
+  }
+
+  //---
+  inline void arrive_and_wait()
+  {
+    count_down();
+    wait();
+  }
+};
+}
\ No newline at end of file
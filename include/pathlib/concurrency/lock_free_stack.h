@@ -0,0 +1,72 @@
+/*
+  Documentation: https://www.path.blog/docs/thread.html
+*/
+
+#pragma once
+#include "pathlib/types/types.h"
+#include "pathlib/concurrency/atomic.h"
+
+//---
+CHECK_HAS_MEMBER(has_stack_next, _next);
+
+namespace Pathlib {
+
+//---
+template <typename T>
+struct LockFreeStack
+{
+  //---
+  static_assert(has_stack_next<T>::value, "LockFreeStack nodes must contain a member 'T* _next'.");
+
+  //---
+  alignas(CACHE_LINE_SIZE) Atomic128 _head;
+
+  //---
+  DISALLOW_COPY(LockFreeStack);
+  LockFreeStack()
+  {
+    clear();
+  }
+  ~LockFreeStack() {}
+
+  //---
+  inline void push(T* node)
+  {
+    Atomic128::Value head = _head.load();
+    while (true) {
+      __atomic_store_n(&node->_next, (T*)head._low, MemOrder::RELAXED);
+      if (_head.compare_and_swap(head, { (u64)node, head._high + 1 })) {
+        return;
+      }
+    }
+  }
+
+  //---
+  [[nodiscard]] inline T* pop()
+  {
+    /* The tag in the high half makes a stale head fail the swap, even if the same node was pushed back (ABA).
+       Popped nodes may still be read by a losing thread, so their memory must stay mapped (pools, arenas). */
+    Atomic128::Value head = _head.load();
+    while (head._low) {
+      T* node = (T*)head._low;
+      T* next = __atomic_load_n(&node->_next, MemOrder::RELAXED);
+      if (_head.compare_and_swap(head, { (u64)next, head._high + 1 })) {
+        return node;
+      }
+    }
+    return nullptr;
+  }
+
+  //---
+  inline bool is_empty()
+  {
+    return (_head.load()._low == 0);
+  }
+
+  //---
+  inline void clear()
+  {
+    _head.store({ 0, 0 });
+  }
+};
+}
\ No newline at end of file
@@ -0,0 +1,162 @@
+/*
+  Documentation: https://www.path.blog/docs/thread.html
+*/
+
+#pragma once
+#include "pathlib/types/types.h"
+#include "pathlib/concurrency/atomic.h"
+
+namespace Pathlib {
+
+//---
+template <typename T,
+          u32 CAPACITY>
+struct MPMCQueue
+{
+  static_assert(Math::is_pot(CAPACITY), "MPMCQueue CAPACITY must be a power of two.");
+  static_assert(IS_TRIVIALLY_COPYABLE(T), "MPMCQueue must have a trivially copyable type; values are stored inline.");
+
+  //---
+  struct Slot
+  {
+    Atomic<u32> _sequence;
+    T _value;
+  };
+
+  //---
+  alignas(CACHE_LINE_SIZE) Atomic<u32> _head;
+  alignas(CACHE_LINE_SIZE) Atomic<u32> _tail;
+  alignas(CACHE_LINE_SIZE) Slot _slots[CAPACITY];
+
+  //---
+  DISALLOW_COPY(MPMCQueue);
+  MPMCQueue()
+  {
+    _head.store(0);
+    _tail.store(0);
+    for (u32 s = 0; s < CAPACITY; ++s) {
+      _slots[s]._sequence.store(s, MemOrder::RELAXED);
+    }
+  }
+  ~MPMCQueue() {}
+
+  //---
+  [[nodiscard]] bool push(const T& object)
+  {
+    u32 position = _head.load(MemOrder::RELAXED);
+    while (true) {
+      Slot& slot = _slots[position & (CAPACITY - 1)];
+      i32 difference = (i32)(slot._sequence.load(MemOrder::ACQUIRE) - position);
+      if (difference == 0) {
+        if (_head.compare_and_swap(position, position + 1, MemOrder::RELAXED)) {
+          slot._value = object;
+          slot._sequence.store(position + 1, MemOrder::RELEASE);
+          return true;
+        }
+      } else if (difference < 0) {
+        return false;
+      }
+      position = _head.load(MemOrder::RELAXED);
+    }
+  }
+
+  //---
+  [[nodiscard]] bool pop(T& object)
+  {
+    u32 position = _tail.load(MemOrder::RELAXED);
+    while (true) {
+      Slot& slot = _slots[position & (CAPACITY - 1)];
+      i32 difference = (i32)(slot._sequence.load(MemOrder::ACQUIRE) - (position + 1));
+      if (difference == 0) {
+        if (_tail.compare_and_swap(position, position + 1, MemOrder::RELAXED)) {
+          object = slot._value;
+          slot._sequence.store(position + CAPACITY, MemOrder::RELEASE);
+          return true;
+        }
+      } else if (difference < 0) {
+        return false;
+      }
+      position = _tail.load(MemOrder::RELAXED);
+    }
+  }
+
+  //---
+  [[nodiscard]] u32 push_n(const T* objects,
+                           u32 count)
+  {
+    if (count == 0) {
+      return 0;
+    }
+    u32 position = _head.load(MemOrder::RELAXED);
+    while (true) {
+      u32 claim = 0;
+      while (claim < count) {
+        Slot& slot = _slots[(position + claim) & (CAPACITY - 1)];
+        if (slot._sequence.load(MemOrder::ACQUIRE) != (position + claim)) {
+          break;
+        }
+        ++claim;
+      }
+      if (claim == 0) {
+        if ((i32)(_slots[position & (CAPACITY - 1)]._sequence.load(MemOrder::ACQUIRE) - position) < 0) {
+          return 0;
+        }
+      } else if (_head.compare_and_swap(position, position + claim, MemOrder::RELAXED)) {
+        for (u32 c = 0; c < claim; ++c) {
+          Slot& slot = _slots[(position + c) & (CAPACITY - 1)];
+          slot._value = objects[c];
+          slot._sequence.store(position + c + 1, MemOrder::RELEASE);
+        }
+        return claim;
+      }
+      position = _head.load(MemOrder::RELAXED);
+    }
+  }
+
+  //---
+  [[nodiscard]] u32 pop_n(T* objects_out,
+                          u32 count)
+  {
+    if (count == 0) {
+      return 0;
+    }
+    u32 position = _tail.load(MemOrder::RELAXED);
+    while (true) {
+      u32 claim = 0;
+      while (claim < count) {
+        Slot& slot = _slots[(position + claim) & (CAPACITY - 1)];
+        if (slot._sequence.load(MemOrder::ACQUIRE) != (position + claim + 1)) {
+          break;
+        }
+        ++claim;
+      }
+      if (claim == 0) {
+        if ((i32)(_slots[position & (CAPACITY - 1)]._sequence.load(MemOrder::ACQUIRE) - (position + 1)) < 0) {
+          return 0;
+        }
+      } else if (_tail.compare_and_swap(position, position + claim, MemOrder::RELAXED)) {
+        for (u32 c = 0; c < claim; ++c) {
+          Slot& slot = _slots[(position + c) & (CAPACITY - 1)];
+          objects_out[c] = slot._value;
+          slot._sequence.store(position + c + CAPACITY, MemOrder::RELEASE);
+        }
+        return claim;
+      }
+      position = _tail.load(MemOrder::RELAXED);
+    }
+  }
+
+  //---
+  inline u32 get_count()
+  {
+    i32 count = (i32)(_head.load(MemOrder::RELAXED) - _tail.load(MemOrder::RELAXED));
+    return (count < 0) ? 0 : Math::min((u32)count, CAPACITY);
+  }
+
+  //---
+  static constexpr u32 get_capacity()
+  {
+    return CAPACITY;
+  }
+};
+}
\ No newline at end of file
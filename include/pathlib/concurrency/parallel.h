@@ -0,0 +1,399 @@
+/*
+  Documentation: https://www.path.blog/docs/thread.html
+*/
+
+#pragma once
+#include "pathlib/types/types.h"
+#include "pathlib/math/math.h"
+#include "pathlib/concurrency/atomic.h"
+#include "pathlib/concurrency/threadpool.h"
+#include "pathlib/memory/memcpy_unsafe.h"
+#include "pathlib/memory/malloc_unsafe.h"
+#include "pathlib/containers/vector.h"
+#include "pathlib/containers/vector_unsafe.h"
+#include "pathlib/containers/array_unsafe.h"
+
+namespace Pathlib {
+namespace _Internal {
+
+//---
+static constexpr u64 AUTO_GRAIN_SIZE = 0;
+static constexpr u64 CHUNKS_PER_THREAD = 4;
+static constexpr u64 MIN_GRAIN_BYTES = 16 * 1024;
+static constexpr u64 INSERTION_SORT_THRESHOLD = 16;
+
+//---
+template <typename T>
+static inline u64 grain_size_for(u64 count,
+                                 u64 grain_size)
+{
+  constexpr u64 ELEMENTS_PER_LINE = ((sizeof(T) < CACHE_LINE_SIZE) && ((CACHE_LINE_SIZE % sizeof(T)) == 0)) ?
+                                    (CACHE_LINE_SIZE / sizeof(T)) : 1;
+  if (grain_size == AUTO_GRAIN_SIZE) {
+    u64 target_chunks = get_threadpool().get_thread_count() * CHUNKS_PER_THREAD;
+    grain_size = Math::max((count + target_chunks - 1) / target_chunks,
+                           Math::max(MIN_GRAIN_BYTES / sizeof(T), (u64)1));
+  }
+  return Math::next_multiple_of_pot(grain_size, ELEMENTS_PER_LINE);
+}
+
+//---
+template <typename Callable>
+struct ParallelTasks
+{
+  //---
+  Callable* _function;
+  u64 _task_count;
+  alignas(CACHE_LINE_SIZE) Atomic<u64> _next_task;
+
+  //---
+  static void run(void* user_data)
+  {
+    ParallelTasks* tasks = (ParallelTasks*)user_data;
+    u64 task = tasks->_next_task.fetch_add(1, MemOrder::RELAXED) - 1;
+    while (task < tasks->_task_count) {
+      (*tasks->_function)(task);
+      task = tasks->_next_task.fetch_add(1, MemOrder::RELAXED) - 1;
+    }
+  }
+};
+
+//---
+template <typename Callable>
+static inline void run_parallel_tasks(u64 task_count,
+                                      Callable&& function)
+{
+  using FUNCTION_TYPE = typename remove_reference<Callable>::value;
+  if (task_count <= 1) {
+    if (task_count == 1) {
+      function(0);
+    }
+    return;
+  }
+  Threadpool& threadpool = get_threadpool();
+  ParallelTasks<FUNCTION_TYPE> tasks;
+  tasks._function = &function;
+  tasks._task_count = task_count;
+  tasks._next_task.store(0, MemOrder::RELAXED);
+  JobCounter counter;
+  u64 job_count = Math::min((u64)threadpool.get_thread_count(), task_count) - 1;
+  for (u64 j = 0; j < job_count; ++j) {
+    threadpool.submit(ParallelTasks<FUNCTION_TYPE>::run, &tasks, &counter);
+  }
+  ParallelTasks<FUNCTION_TYPE>::run(&tasks);
+  threadpool.wait(counter);
+}
+
+//---
+template <typename T,
+          typename Less>
+static inline void insertion_sort(T* data,
+                                  u64 count,
+                                  Less& less)
+{
+  for (u64 i = 1; i < count; ++i) {
+    T value = data[i];
+    u64 j = i;
+    while ((j > 0) && less(value, data[j - 1])) {
+      data[j] = data[j - 1];
+      --j;
+    }
+    data[j] = value;
+  }
+}
+
+//---
+template <typename T,
+          typename Less>
+static inline void sort(T* data,
+                        u64 count,
+                        Less& less)
+{
+  while (count > INSERTION_SORT_THRESHOLD) {
+    u64 mid = count >> 1;
+    T& a = data[0];
+    T& b = data[mid];
+    T& c = data[count - 1];
+    T pivot = less(a, b) ? (less(b, c) ? b : (less(a, c) ? c : a)) :
+                           (less(a, c) ? a : (less(b, c) ? c : b));
+    i64 i = -1;
+    i64 j = count;
+    while (true) {
+      do { ++i; } while (less(data[i], pivot));
+      do { --j; } while (less(pivot, data[j]));
+      if (i >= j) {
+        break;
+      }
+      T swap = data[i];
+      data[i] = data[j];
+      data[j] = swap;
+    }
+    u64 left_count = j + 1;
+    if (left_count < (count - left_count)) {
+      sort(data, left_count, less);
+      data += left_count;
+      count -= left_count;
+    } else {
+      sort(data + left_count, count - left_count, less);
+      count = left_count;
+    }
+  }
+  insertion_sort(data, count, less);
+}
+
+//---
+template <typename T,
+          typename Less>
+static inline void merge(const T* src,
+                         u64 begin,
+                         u64 middle,
+                         u64 end,
+                         T* dst,
+                         Less& less)
+{
+  u64 left = begin;
+  u64 right = middle;
+  u64 out = begin;
+  while ((left < middle) && (right < end)) {
+    if (less(src[right], src[left])) {
+      dst[out++] = src[right++];
+    } else {
+      dst[out++] = src[left++];
+    }
+  }
+  if (left < middle) {
+    memcpy_unsafe(dst + out, src + left, sizeof(T) * (middle - left));
+  } else if (right < end) {
+    memcpy_unsafe(dst + out, src + right, sizeof(T) * (end - right));
+  }
+}
+}
+
+//---
+template <typename T,
+          typename Callable>
+static inline void parallel_for_unsafe(T* data,
+                                       u64 count,
+                                       Callable&& function,
+                                       u64 grain_size = _Internal::AUTO_GRAIN_SIZE)
+{
+  static_assert(HasTParameter<T&, Callable>::value,
+                "parallel_for callback must take a parameter with a reference to the element type: '(T& element)'");
+  grain_size = _Internal::grain_size_for<T>(count, grain_size);
+  u64 chunk_count = (count + grain_size - 1) / grain_size;
+  _Internal::run_parallel_tasks(chunk_count, [&](u64 chunk)
+    {
+      u64 begin = chunk * grain_size;
+      u64 end = Math::min(begin + grain_size, count);
+      for (u64 e = begin; e < end; ++e) {
+        function(data[e]);
+      }
+    });
+}
+
+//---
+template <typename T,
+          typename R,
+          typename Accumulate,
+          typename Combine>
+static inline R parallel_reduce_unsafe(T* data,
+                                       u64 count,
+                                       const R& identity,
+                                       Accumulate&& accumulate,
+                                       Combine&& combine,
+                                       u64 grain_size = _Internal::AUTO_GRAIN_SIZE)
+{
+  static_assert(SAME_TYPE(typename result_of<Accumulate(R, T&)>::value, R),
+                "parallel_reduce accumulate callback must have the form: 'R (R accumulator, T& element)'");
+  static_assert(SAME_TYPE(typename result_of<Combine(R, R)>::value, R),
+                "parallel_reduce combine callback must have the form: 'R (R a, R b)'");
+  grain_size = _Internal::grain_size_for<T>(count, grain_size);
+  u64 chunk_count = (count + grain_size - 1) / grain_size;
+  if (chunk_count == 0) {
+    return identity;
+  }
+  R* partials = (R*)malloc_unsafe(sizeof(R) * chunk_count, u8"parallel_reduce::_partials");
+  _Internal::run_parallel_tasks(chunk_count, [&](u64 chunk)
+    {
+      u64 begin = chunk * grain_size;
+      u64 end = Math::min(begin + grain_size, count);
+      R partial = identity;
+      for (u64 e = begin; e < end; ++e) {
+        partial = accumulate(partial, data[e]);
+      }
+      partials[chunk] = partial;
+    });
+  R result = partials[0];
+  for (u64 c = 1; c < chunk_count; ++c) {
+    result = combine(result, partials[c]);
+  }
+  free_unsafe((void**)&partials);
+  return result;
+}
+
+//---
+template <typename T,
+          typename Less>
+static inline void parallel_sort_unsafe(T* data,
+                                        u64 count,
+                                        Less&& less,
+                                        u64 grain_size = _Internal::AUTO_GRAIN_SIZE)
+{
+  static_assert(SAME_TYPE(typename result_of<Less(const T&, const T&)>::value, bool),
+                "parallel_sort comparison callback must have the form: 'bool (const T& a, const T& b)'");
+  grain_size = _Internal::grain_size_for<T>(count, grain_size);
+  u64 chunk_count = (count + grain_size - 1) / grain_size;
+  if (chunk_count <= 1) {
+    _Internal::sort(data, count, less);
+    return;
+  }
+  _Internal::run_parallel_tasks(chunk_count, [&](u64 chunk)
+    {
+      u64 begin = chunk * grain_size;
+      u64 end = Math::min(begin + grain_size, count);
+      _Internal::sort(data + begin, end - begin, less);
+    });
+  T* scratch = (T*)malloc_unsafe(sizeof(T) * count, u8"parallel_sort::_scratch");
+  T* src = data;
+  T* dst = scratch;
+  for (u64 width = grain_size; width < count; width <<= 1) {
+    u64 pair_count = (count + (width << 1) - 1) / (width << 1);
+    _Internal::run_parallel_tasks(pair_count, [&](u64 pair)
+      {
+        u64 begin = pair * (width << 1);
+        u64 middle = Math::min(begin + width, count);
+        u64 end = Math::min(begin + (width << 1), count);
+        _Internal::merge(src, begin, middle, end, dst, less);
+      });
+    T* swap = src;
+    src = dst;
+    dst = swap;
+  }
+  if (src != data) {
+    memcpy_unsafe(data, src, sizeof(T) * count);
+  }
+  free_unsafe((void**)&scratch);
+}
+
+//---
+template <typename T>
+static inline void parallel_sort_unsafe(T* data,
+                                        u64 count)
+{
+  parallel_sort_unsafe(data, count, [](const T& a, const T& b) { return (a < b); });
+}
+
+//---
+template <typename T,
+          u64 RESERVE_CAPACITY,
+          typename Callable>
+static inline void parallel_for(Vector<T, RESERVE_CAPACITY>& vector,
+                                Callable&& function,
+                                u64 grain_size = _Internal::AUTO_GRAIN_SIZE)
+{
+  parallel_for_unsafe(vector.get_data(), vector.get_count(), function, grain_size);
+}
+
+//---
+template <typename T,
+          u64 RESERVE_CAPACITY,
+          typename ALLOCATOR,
+          typename Callable>
+static inline void parallel_for(VectorUnsafe<T, RESERVE_CAPACITY, ALLOCATOR>& vector,
+                                Callable&& function,
+                                u64 grain_size = _Internal::AUTO_GRAIN_SIZE)
+{
+  parallel_for_unsafe(vector._data, vector._count, function, grain_size);
+}
+
+//---
+template <typename T,
+          u64 CAPACITY,
+          typename Callable>
+static inline void parallel_for(ArrayUnsafe<T, CAPACITY>& array,
+                                Callable&& function,
+                                u64 grain_size = _Internal::AUTO_GRAIN_SIZE)
+{
+  parallel_for_unsafe(array._data, array._count, function, grain_size);
+}
+
+//---
+template <typename T,
+          u64 RESERVE_CAPACITY,
+          typename R,
+          typename Accumulate,
+          typename Combine>
+static inline R parallel_reduce(Vector<T, RESERVE_CAPACITY>& vector,
+                                const R& identity,
+                                Accumulate&& accumulate,
+                                Combine&& combine,
+                                u64 grain_size = _Internal::AUTO_GRAIN_SIZE)
+{
+  return parallel_reduce_unsafe(vector.get_data(), vector.get_count(), identity, accumulate, combine, grain_size);
+}
+
+//---
+template <typename T,
+          u64 RESERVE_CAPACITY,
+          typename ALLOCATOR,
+          typename R,
+          typename Accumulate,
+          typename Combine>
+static inline R parallel_reduce(VectorUnsafe<T, RESERVE_CAPACITY, ALLOCATOR>& vector,
+                                const R& identity,
+                                Accumulate&& accumulate,
+                                Combine&& combine,
+                                u64 grain_size = _Internal::AUTO_GRAIN_SIZE)
+{
+  return parallel_reduce_unsafe(vector._data, vector._count, identity, accumulate, combine, grain_size);
+}
+
+//---
+template <typename T,
+          u64 CAPACITY,
+          typename R,
+          typename Accumulate,
+          typename Combine>
+static inline R parallel_reduce(ArrayUnsafe<T, CAPACITY>& array,
+                                const R& identity,
+                                Accumulate&& accumulate,
+                                Combine&& combine,
+                                u64 grain_size = _Internal::AUTO_GRAIN_SIZE)
+{
+  return parallel_reduce_unsafe(array._data, array._count, identity, accumulate, combine, grain_size);
+}
+
+//---
+template <typename T,
+          u64 RESERVE_CAPACITY,
+          typename Less>
+static inline void parallel_sort(Vector<T, RESERVE_CAPACITY>& vector,
+                                 Less&& less,
+                                 u64 grain_size = _Internal::AUTO_GRAIN_SIZE)
+{
+  parallel_sort_unsafe(vector.get_data(), vector.get_count(), less, grain_size);
+}
+
+//---
+template <typename T,
+          u64 RESERVE_CAPACITY,
+          typename ALLOCATOR,
+          typename Less>
+static inline void parallel_sort(VectorUnsafe<T, RESERVE_CAPACITY, ALLOCATOR>& vector,
+                                 Less&& less,
+                                 u64 grain_size = _Internal::AUTO_GRAIN_SIZE)
+{
+  parallel_sort_unsafe(vector._data, vector._count, less, grain_size);
+}
+
+//---
+template <typename T,
+          u64 CAPACITY,
+          typename Less>
+static inline void parallel_sort(ArrayUnsafe<T, CAPACITY>& array,
+                                 Less&& less,
+                                 u64 grain_size = _Internal::AUTO_GRAIN_SIZE)
+{
+  parallel_sort_unsafe(array._data, array._count, less, grain_size);
+}
+}
\ No newline at end of file
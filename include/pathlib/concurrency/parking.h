@@ -0,0 +1,29 @@
+/*
+  Documentation: https://www.path.blog/docs/thread.html
+*/
+
+#pragma once
+#include "pathlib/types/types.h"
+#include "pathlib/concurrency/atomic.h"
+#include "pathlib/win32/safe_win32.h"
+
+namespace Pathlib::_Internal {
+
+//---
+static constexpr u32 PARKING_SPIN_COUNT = 128;
+
+//---
+static inline void wait_while_equal(Atomic<u32>& atomic,
+                                    u32 value)
+{
+  for (u32 s = 0; s < PARKING_SPIN_COUNT; ++s) {
+    if (atomic.load(MemOrder::ACQUIRE) != value) {
+      return;
+    }
+    __builtin_ia32_pause();
+  }
+  while (atomic.load(MemOrder::ACQUIRE) == value) {
+    Win32::wait_on_address(&atomic._value, &value, sizeof(u32), Win32::INFINITE_TIMEOUT);
+  }
+}
+}
\ No newline at end of file
@@ -0,0 +1,90 @@
+/*
+  Documentation: https://www.path.blog/docs/thread.html
+*/
+
+#pragma once
+#include "pathlib/types/types.h"
+#include "pathlib/concurrency/atomic.h"
+#include "pathlib/concurrency/spinlock.h"
+#include "pathlib/errors/errors.h"
+
+namespace Pathlib::_Internal {
+
+//---
+template <typename Participant,
+          u32 MAX_PARTICIPANTS>
+struct ParticipantRegistry
+{
+  //---
+  alignas(CACHE_LINE_SIZE) Atomic<u32> _count;
+  Spinlock _lock;
+  Participant* _participants[MAX_PARTICIPANTS];
+
+  //---
+  DISALLOW_COPY(ParticipantRegistry);
+  ParticipantRegistry()
+  {
+    _count.store(0);
+    for (u32 p = 0; p < MAX_PARTICIPANTS; ++p) {
+      _participants[p] = nullptr;
+    }
+  }
+  ~ParticipantRegistry() {}
+
+  //---
+  template <typename Create>
+  u32 claim(Create&& create,
+            const utf8* exhausted_message)
+  {
+    /* Slots are never freed, only marked unused, so readers may scan up to _count without the lock. */
+    _lock.acquire();
+    u32 count = _count.load(MemOrder::RELAXED);
+    for (u32 p = 0; p < count; ++p) {
+      if (_participants[p]->_in_use.compare_and_swap(0, 1, MemOrder::ACQUIRE)) {
+        _lock.release();
+        return p;
+      }
+    }
+    if (DONT_EXPECT(count == MAX_PARTICIPANTS)) {
+      get_errors().fatal(exhausted_message);
+    }
+    Participant* participant = create();
+    participant->_in_use.store(1, MemOrder::RELAXED);
+    _participants[count] = participant;
+    _count.store(count + 1, MemOrder::RELEASE);
+    _lock.release();
+    return count;
+  }
+
+  //---
+  inline void release(u32 index)
+  {
+    _participants[index]->_in_use.store(0, MemOrder::RELEASE);
+  }
+
+  //---
+  inline Participant& operator[](u32 index)
+  {
+    return *_participants[index];
+  }
+
+  //---
+  inline u32 get_count()
+  {
+    return _count.load(MemOrder::ACQUIRE);
+  }
+};
+
+//---
+struct ThreadExitHook
+{
+  /* Held thread_local; a thread that exits without unregistering still gives its slot back. */
+  void(*_function)();
+  ~ThreadExitHook()
+  {
+    if (_function) {
+      _function();
+    }
+  }
+};
+}
\ No newline at end of file
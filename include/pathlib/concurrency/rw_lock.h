@@ -0,0 +1,100 @@
+/*
+  Documentation: https://www.path.blog/docs/thread.html
+*/
+
+#pragma once
+#include "pathlib/types/types.h"
+#include "pathlib/concurrency/atomic.h"
+#include "pathlib/concurrency/spinlock.h"
+#include "pathlib/concurrency/cache_padded.h"
+#include "pathlib/win32/safe_win32.h"
+
+namespace Pathlib {
+
+//---
+struct RWLock
+{
+  //---
+  static constexpr u32 READER_SLOTS = 64;
+  static constexpr u32 SPIN_COUNT = 128;
+
+  //---
+  alignas(CACHE_LINE_SIZE) Atomic<u32> _writer;
+  Atomic<u32> _parked_readers;
+  Spinlock _writer_lock;
+  CachePadded<Atomic<u32>> _readers[READER_SLOTS];
+
+  //---
+  DISALLOW_COPY(RWLock);
+  RWLock()
+  {
+    _writer.store(0);
+    _parked_readers.store(0);
+    for (u32 r = 0; r < READER_SLOTS; ++r) {
+      _readers[r]->store(0, MemOrder::RELAXED);
+    }
+  }
+  ~RWLock() {}
+
+  //---
+  [[nodiscard]] inline u32 acquire_read()
+  {
+    u32 slot = Win32::get_current_processor() & (READER_SLOTS - 1);
+    while (true) {
+      _readers[slot]->fetch_add(1, MemOrder::SEQ_CST);
+      if (EXPECT(_writer.load(MemOrder::SEQ_CST) == 0)) {
+        return slot;
+      }
+      release_read(slot);
+      u32 spins = 0;
+      while (_writer.load(MemOrder::ACQUIRE) != 0) {
+        if (++spins < SPIN_COUNT) {
+          __builtin_ia32_pause();
+        } else {
+          u32 writing = 1;
+          _parked_readers.fetch_add(1, MemOrder::SEQ_CST);
+          Win32::wait_on_address(&_writer._value, &writing, sizeof(u32), Win32::INFINITE_TIMEOUT);
+          _parked_readers.fetch_sub(1, MemOrder::RELAXED);
+        }
+      }
+    }
+  }
+
+  //---
+  inline void release_read(u32 slot)
+  {
+    /* The last reader out of a slot wakes a writer parked on it. */
+    if ((_readers[slot]->fetch_sub(1, MemOrder::SEQ_CST) == 0) && (_writer.load(MemOrder::SEQ_CST) != 0)) {
+      Win32::wake_by_address_single((void*)&_readers[slot]->_value);
+    }
+  }
+
+  //---
+  inline void acquire_write()
+  {
+    _writer_lock.acquire();
+    _writer.store(1, MemOrder::SEQ_CST);
+    for (u32 r = 0; r < READER_SLOTS; ++r) {
+      u32 spins = 0;
+      u32 readers;
+      while ((readers = _readers[r]->load(MemOrder::SEQ_CST)) != 0) {
+        if (++spins < SPIN_COUNT) {
+          __builtin_ia32_pause();
+        } else {
+          Win32::wait_on_address(&_readers[r]->_value, &readers, sizeof(u32), Win32::INFINITE_TIMEOUT);
+        }
+      }
+    }
+  }
+
+  //---
+  inline void release_write()
+  {
+    _writer.store(0, MemOrder::SEQ_CST);
+    if (_parked_readers.load(MemOrder::SEQ_CST) > 0) {
+      Win32::wake_by_address_all((void*)&_writer._value);
+    }
+    _writer_lock.release();
+  }
+};
+}
\ No newline at end of file
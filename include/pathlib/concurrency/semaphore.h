@@ -0,0 +1,64 @@
+/*
+  Documentation: https://www.path.blog/docs/thread.html
+*/
+
+#pragma once
+#include "pathlib/types/types.h"
+#include "pathlib/concurrency/atomic.h"
+#include "pathlib/concurrency/parking.h"
+
+namespace Pathlib {
+
+//---
+struct Semaphore
+{
+  //---
+  alignas(CACHE_LINE_SIZE) Atomic<u32> _count;
+  Atomic<u32> _waiters;
+
+  //---
+  DISALLOW_COPY(Semaphore);
+  explicit Semaphore(u32 count = 0)
+  {
+    _count.store(count);
+    _waiters.store(0);
+  }
+  ~Semaphore() {}
+
+  //---
+  [[nodiscard]] inline bool try_acquire()
+  {
+    u32 count = _count.load(MemOrder::RELAXED);
+    while (count > 0) {
+      if (_count.compare_and_swap(count, count - 1, MemOrder::ACQUIRE)) {
+        return true;
+      }
+      count = _count.load(MemOrder::RELAXED);
+    }
+    return false;
+  }
+
+  //---
+  inline void acquire()
+  {
+    while (!try_acquire()) {
+      _waiters.fetch_add(1, MemOrder::SEQ_CST);
+      _Internal::wait_while_equal(_count, 0);
+      _waiters.fetch_sub(1, MemOrder::RELAXED);
+    }
+  }
+
+  //---
+  inline void release(u32 count = 1)
+  {
+    _count.fetch_add(count, MemOrder::SEQ_CST);
+    if (_waiters.load(MemOrder::SEQ_CST) > 0) {
+      if (count == 1) {
+        Win32::wake_by_address_single((void*)&_count._value);
+      } else {
+        Win32::wake_by_address_all((void*)&_count._value);
+      }
+    }
+  }
+};
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+/*
+  Documentation: https://www.path.blog/docs/thread.html
+*/
+
+#pragma once
+#include "pathlib/types/types.h"
+#include "pathlib/concurrency/atomic.h"
+
+namespace Pathlib {
+
+//---
+template <typename T>
+struct Seqlock
+{
+  static_assert(IS_TRIVIALLY_COPYABLE(T), "Seqlock must have a trivially copyable type; readers copy it while it may be written.");
+
+  //---
+  alignas(CACHE_LINE_SIZE) Atomic<u32> _sequence;
+  T _value;
+
+  //---
+  DISALLOW_COPY(Seqlock);
+  Seqlock()
+  {
+    _sequence.store(0);
+  }
+  explicit Seqlock(const T& value)
+  {
+    _value = value;
+    _sequence.store(0);
+  }
+  ~Seqlock() {}
+
+  //---
+  inline T read()
+  {
+    while (true) {
+      u32 sequence = _sequence.load(MemOrder::ACQUIRE);
+      if (DONT_EXPECT(sequence & 1)) {
+        __builtin_ia32_pause();
+        continue;
+      }
+      T value = _value;
+      atomic_fence(MemOrder::ACQUIRE);
+      if (EXPECT(_sequence.load(MemOrder::RELAXED) == sequence)) {
+        return value;
+      }
+    }
+  }
+
+  //---
+  inline void write(const T& value)
+  {
+    while (true) {
+      u32 sequence = _sequence.load(MemOrder::RELAXED);
+      if (!(sequence & 1) && _sequence.compare_and_swap(sequence, sequence + 1, MemOrder::ACQUIRE)) {
+        atomic_fence(MemOrder::RELEASE);
+        _value = value;
+        _sequence.store(sequence + 2, MemOrder::RELEASE);
+        return;
+      }
+      __builtin_ia32_pause();
+    }
+  }
+};
+}
\ No newline at end of file
@@ -0,0 +1,61 @@
+/*
+  Documentation: https://www.path.blog/docs/thread.html
+*/
+
+#pragma once
+#include "pathlib/types/types.h"
+#include "pathlib/math/math.h"
+#include "pathlib/concurrency/atomic.h"
+#include "pathlib/concurrency/cache_padded.h"
+#include "pathlib/win32/safe_win32.h"
+
+namespace Pathlib {
+
+//---
+template <u32 SLOT_COUNT = 64>
+struct ShardedCounter
+{
+  static_assert(Math::is_pot(SLOT_COUNT), "ShardedCounter SLOT_COUNT must be a power of two.");
+
+  //---
+  CachePadded<Atomic<u64>> _slots[SLOT_COUNT];
+
+  //---
+  DISALLOW_COPY(ShardedCounter);
+  ShardedCounter()
+  {
+    clear();
+  }
+  ~ShardedCounter() {}
+
+  //---
+  inline void add(u64 value = 1)
+  {
+    _slots[Win32::get_current_processor() & (SLOT_COUNT - 1)]->fetch_add(value, MemOrder::RELAXED);
+  }
+
+  //---
+  inline void sub(u64 value = 1)
+  {
+    _slots[Win32::get_current_processor() & (SLOT_COUNT - 1)]->fetch_sub(value, MemOrder::RELAXED);
+  }
+
+  //---
+  inline u64 get()
+  {
+    u64 total = 0;
+    for (u32 s = 0; s < SLOT_COUNT; ++s) {
+      total += _slots[s]->load(MemOrder::RELAXED);
+    }
+    return total;
+  }
+
+  //---
+  inline void clear()
+  {
+    for (u32 s = 0; s < SLOT_COUNT; ++s) {
+      _slots[s]->store(0, MemOrder::RELAXED);
+    }
+  }
+};
+}
\ No newline at end of file
@@ -4,10 +4,9 @@
 
 #pragma once
 #include "pathlib/types/types.h"
+#include "pathlib/math/math.h"
 #include "pathlib/concurrency/atomic.h"
-#include "pathlib/concurrency/mpsc_queue.h"
-#include "pathlib/concurrency/threadpool.h"
-#include "pathlib/errors/errors.h"
+#include "pathlib/win32/safe_win32.h"
 
 namespace Pathlib {
 
@@ -16,14 +15,21 @@ struct Spinlock
 {
   //---
   static constexpr u32 NO_OWNER = Types::U32_MAX;
+  static constexpr u32 UNLOCKED = 0;
+  static constexpr u32 LOCKED = 1;
+  static constexpr u32 LOCKED_WITH_WAITERS = 2;
+  static constexpr u32 SPIN_COUNT = 64;
+  static constexpr u32 MAX_BACKOFF = 64;
 
   //---
-  MPSCQueue<volatile u32*, _Internal::Threadpool::MAX_THREAD_COUNT> _queue;
+  alignas(CACHE_LINE_SIZE) Atomic<u32> _state;
   Atomic<u32> _owner;
 
   //---
-  Spinlock() 
+  DISALLOW_COPY(Spinlock);
+  Spinlock()
   {
+    _state.store(UNLOCKED);
     _owner.store(NO_OWNER);
   }
   ~Spinlock() {}
@@ -31,43 +37,44 @@ struct Spinlock
   //
   [[nodiscard]] inline bool try_acquire()
   {
-    return _owner.compare_and_swap(NO_OWNER, Win32::get_current_thread_id());
+    if (_state.compare_and_swap(UNLOCKED, LOCKED, MemOrder::ACQUIRE)) {
+      _owner.store(Win32::get_current_thread_id(), MemOrder::RELAXED);
+      return true;
+    }
+    return false;
   }
 
   //---
-  [[nodiscard]] inline bool acquire()
+  inline void acquire()
   {
+    /* Not FIFO: a running thread may take the lock ahead of a parked waiter, which keeps hot locks off the scheduler. */
     if (try_acquire()) {
-      return true;
-    } else {
-      volatile u32 wait = 1;
-      if (_queue.push(&wait)) {
-        u32 spins = 0;
-        while (wait) {
-          if (++spins < 2000) {
-            __builtin_ia32_pause();
-          } else {
-            Win32::yield_thread();
-          }
-        }
-        _owner.store(Win32::get_current_thread_id());
-        return true;
-      } else {
-        get_errors().to_log_with_stacktrace(u8"Spinlock _queue overflowed; could not acquire lock.");
-        return false;
+      return;
+    }
+    u32 backoff = 1;
+    for (u32 s = 0; s < SPIN_COUNT; ++s) {
+      if ((_state.load(MemOrder::RELAXED) == UNLOCKED) && try_acquire()) {
+        return;
+      }
+      for (u32 p = 0; p < backoff; ++p) {
+        __builtin_ia32_pause();
       }
+      backoff = Math::min(backoff << 1, MAX_BACKOFF);
+    }
+    while (_state.swap(LOCKED_WITH_WAITERS, MemOrder::ACQUIRE) != UNLOCKED) {
+      u32 contended = LOCKED_WITH_WAITERS;
+      Win32::wait_on_address(&_state._value, &contended, sizeof(u32), Win32::INFINITE_TIMEOUT);
     }
+    _owner.store(Win32::get_current_thread_id(), MemOrder::RELAXED);
   }
 
   //---
   inline void release()
   {
-    if (_owner.load() == Win32::get_current_thread_id()) {
-      volatile u32* next;
-      if (_queue.pop(next)) {
-        *next = 0;
-      } else {
-        _owner.store(NO_OWNER);
+    if (_owner.load(MemOrder::RELAXED) == Win32::get_current_thread_id()) {
+      _owner.store(NO_OWNER, MemOrder::RELAXED);
+      if (_state.swap(UNLOCKED, MemOrder::RELEASE) == LOCKED_WITH_WAITERS) {
+        Win32::wake_by_address_single((void*)&_state._value);
       }
     }
   }
@@ -0,0 +1,125 @@
+/*
+  Documentation: https://www.path.blog/docs/thread.html
+*/
+
+#pragma once
+#include "pathlib/types/types.h"
+#include "pathlib/concurrency/atomic.h"
+#include "pathlib/containers/safe_ptr.h"
+
+namespace Pathlib {
+
+//---
+template <u32 CAPACITY>
+struct SPSCRing
+{
+  static_assert(Math::is_pot(CAPACITY), "SPSCRing CAPACITY must be a power of two.");
+
+  //---
+  static constexpr u64 NO_SKIP = Types::U64_MAX;
+  static constexpr u64 MAX_RESERVE_SIZE = (CAPACITY / 2);
+
+  //---
+  alignas(CACHE_LINE_SIZE) Atomic<u64> _head;
+  Atomic<u64> _skip;
+  u64 _cached_tail;
+  u64 _reserved_start;
+  u64 _reserved_size;
+  alignas(CACHE_LINE_SIZE) Atomic<u64> _tail;
+  u64 _cached_head;
+  alignas(CACHE_LINE_SIZE) u8 _data[CAPACITY];
+
+  //---
+  DISALLOW_COPY(SPSCRing);
+  SPSCRing()
+  {
+    _head.store(0);
+    _skip.store(NO_SKIP);
+    _tail.store(0);
+    _cached_tail = 0;
+    _cached_head = 0;
+    _reserved_start = 0;
+    _reserved_size = 0;
+  }
+  ~SPSCRing() {}
+
+  //---
+  [[nodiscard]] SafePtr<u8> reserve(u64 size)
+  {
+    /* A wrapped reservation wastes less than size bytes; with size capped at half the ring, it always fits once the consumer drains. */
+    if (DONT_EXPECT((size == 0) || (size > MAX_RESERVE_SIZE))) {
+      return SafePtr<u8>(nullptr, 0);
+    }
+    u64 head = _head.load(MemOrder::RELAXED);
+    u64 contiguous = CAPACITY - (head & (CAPACITY - 1));
+    u64 start = (size <= contiguous) ? head : (head + contiguous);
+    if ((start + size - _cached_tail) > CAPACITY) {
+      _cached_tail = _tail.load(MemOrder::ACQUIRE);
+      if ((start + size - _cached_tail) > CAPACITY) {
+        return SafePtr<u8>(nullptr, 0);
+      }
+    }
+    _reserved_start = start;
+    _reserved_size = size;
+    return SafePtr<u8>(&_data[start & (CAPACITY - 1)], size);
+  }
+
+  //---
+  void commit(u64 size)
+  {
+    size = Math::min(size, _reserved_size);
+    _reserved_size = 0;
+    if (size == 0) {
+      return;
+    }
+    u64 head = _head.load(MemOrder::RELAXED);
+    if (_reserved_start != head) {
+      _skip.store(head, MemOrder::RELAXED);
+    }
+    _head.store(_reserved_start + size, MemOrder::RELEASE);
+  }
+
+  //---
+  [[nodiscard]] SafePtr<u8> peek()
+  {
+    u64 tail = _tail.load(MemOrder::RELAXED);
+    if (tail == _cached_head) {
+      _cached_head = _head.load(MemOrder::ACQUIRE);
+      if (tail == _cached_head) {
+        return SafePtr<u8>(nullptr, 0);
+      }
+    }
+    u64 skip = _skip.load(MemOrder::RELAXED);
+    if (tail == skip) {
+      tail = Math::next_multiple_of_pot(tail + 1, (u64)CAPACITY);
+      _tail.store(tail, MemOrder::RELEASE);
+    }
+    u64 offset = tail & (CAPACITY - 1);
+    u64 size = Math::min(_cached_head - tail, CAPACITY - offset);
+
+    /* Bytes between the skip point and the end of the ring are padding, never written by the producer. */
+    if ((tail < skip) && (skip <= _cached_head)) {
+      size = Math::min(size, skip - tail);
+    }
+    return SafePtr<u8>(&_data[offset], size);
+  }
+
+  //---
+  void release(u64 size)
+  {
+    _tail.store(_tail.load(MemOrder::RELAXED) + size, MemOrder::RELEASE);
+  }
+
+  //---
+  inline u64 get_count()
+  {
+    return (_head.load(MemOrder::ACQUIRE) - _tail.load(MemOrder::ACQUIRE));
+  }
+
+  //---
+  static constexpr u32 get_capacity()
+  {
+    return CAPACITY;
+  }
+};
+}
\ No newline at end of file
@@ -0,0 +1,91 @@
+/*
+  Documentation: https://www.path.blog/docs/thread.html
+*/
+
+#pragma once
+#include "pathlib/types/types.h"
+#include "pathlib/concurrency/atomic.h"
+
+namespace Pathlib {
+
+//---
+template <typename T,
+          u32 CAPACITY>
+struct StealingDeque
+{
+  static_assert(Math::is_pot(CAPACITY), "StealingDeque CAPACITY must be a power of two.");
+
+  //---
+  alignas(CACHE_LINE_SIZE) Atomic<i64> _top;
+  alignas(CACHE_LINE_SIZE) Atomic<i64> _bottom;
+  alignas(CACHE_LINE_SIZE) T _data[CAPACITY];
+
+  //---
+  DISALLOW_COPY(StealingDeque);
+  StealingDeque()
+  {
+    clear();
+  }
+  ~StealingDeque() {}
+
+  //---
+  inline void clear()
+  {
+    _top.store(0);
+    _bottom.store(0);
+  }
+
+  //---
+  [[nodiscard]] bool push(const T& object)
+  {
+    i64 bottom = _bottom.load(MemOrder::RELAXED);
+    i64 top = _top.load(MemOrder::ACQUIRE);
+    if ((bottom - top) >= (i64)CAPACITY) {
+      return false;
+    }
+    _data[bottom & (CAPACITY - 1)] = object;
+    _bottom.store(bottom + 1, MemOrder::RELEASE);
+    return true;
+  }
+
+  //---
+  [[nodiscard]] bool pop(T& object)
+  {
+    i64 bottom = _bottom.load(MemOrder::RELAXED) - 1;
+    _bottom.store(bottom, MemOrder::RELAXED);
+    atomic_fence(MemOrder::SEQ_CST);
+    i64 top = _top.load(MemOrder::RELAXED);
+    if (top > bottom) {
+      _bottom.store(bottom + 1, MemOrder::RELAXED);
+      return false;
+    }
+    object = _data[bottom & (CAPACITY - 1)];
+    if (top == bottom) {
+      bool won = _top.compare_and_swap(top, top + 1, MemOrder::SEQ_CST);
+      _bottom.store(bottom + 1, MemOrder::RELAXED);
+      return won;
+    }
+    return true;
+  }
+
+  //---
+  [[nodiscard]] bool steal(T& object)
+  {
+    i64 top = _top.load(MemOrder::ACQUIRE);
+    atomic_fence(MemOrder::SEQ_CST);
+    i64 bottom = _bottom.load(MemOrder::ACQUIRE);
+    if (top >= bottom) {
+      return false;
+    }
+    /* A torn read here is discarded; the owner can only overwrite this slot after _top has moved. */
+    object = _data[top & (CAPACITY - 1)];
+    return _top.compare_and_swap(top, top + 1, MemOrder::SEQ_CST);
+  }
+
+  //---
+  inline bool is_empty()
+  {
+    return (_bottom.load(MemOrder::ACQUIRE) <= _top.load(MemOrder::ACQUIRE));
+  }
+};
+}
\ No newline at end of file
@@ -0,0 +1,259 @@
+/*
+  Documentation: https://www.path.blog/docs/thread.html
+*/
+
+#pragma once
+#include "pathlib/types/types.h"
+#include "pathlib/concurrency/atomic.h"
+#include "pathlib/concurrency/coroutine.h"
+#include "pathlib/concurrency/lock_free_stack.h"
+#include "pathlib/concurrency/spinlock.h"
+#include "pathlib/concurrency/thread.h"
+#include "pathlib/concurrency/threadpool.h"
+#include "pathlib/memory/arena.h"
+#include "pathlib/errors/errors.h"
+#include "pathlib/timer/timer.h"
+
+namespace Pathlib::_Internal {
+
+//---
+struct CoroutineFrames
+{
+  //---
+  static constexpr u64 ARENA_CAPACITY = 16 * 1024 * 1024;
+  static constexpr u64 MIN_FRAME_SIZE = 64;
+  static constexpr u32 SIZE_CLASS_COUNT = 12;
+
+  //---
+  struct FreeFrame
+  {
+    FreeFrame* _next;
+  };
+
+  //---
+  Arena _arena;
+  LockFreeStack<FreeFrame> _free_frames[SIZE_CLASS_COUNT];
+
+  //---
+  DISALLOW_COPY(CoroutineFrames);
+  CoroutineFrames();
+  ~CoroutineFrames();
+
+  //---
+  void* allocate(u64 size);
+  void free(void* frame,
+            u64 size);
+};
+
+//---
+struct Sleepers
+{
+  //---
+  static constexpr u32 RESERVE_CAPACITY = 256;
+  static constexpr u32 RESUME_BATCH = 64;
+
+  //---
+  struct Sleeper
+  {
+    u64 _deadline_ms;
+    void* _frame;
+  };
+
+  //---
+  Spinlock _lock;
+  Sleeper* _heap;
+  u32 _count;
+  u32 _capacity;
+  alignas(CACHE_LINE_SIZE) Atomic<u32> _wake_epoch;
+  Atomic<u32> _running;
+  Thread _thread;
+
+  //---
+  DISALLOW_COPY(Sleepers);
+  Sleepers();
+  ~Sleepers();
+
+  //---
+  void push(u64 deadline_ms,
+            void* frame);
+  u64 resume_expired(u64 now_ms);
+};
+
+//---
+void resume_coroutine(void* frame);
+
+//---
+struct TaskPromiseBase
+{
+  //---
+  std::coroutine_handle<> _continuation;
+  JobCounter* _counter;
+  bool _detached;
+
+  //---
+  struct FinalAwaiter
+  {
+    bool await_ready() noexcept { return false; }
+    template <typename Promise>
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+    {
+      TaskPromiseBase& promise = handle.promise();
+      if (promise._continuation) {
+        return promise._continuation;
+      }
+
+      /* The waiter may destroy the frame and the counter as soon as the counter drops, so only the counter's address is used after. */
+      if (promise._counter) {
+        Atomic<u32>& pending = promise._counter->_pending;
+        if (pending.fetch_sub(1, MemOrder::RELEASE) == 0) {
+          Win32::wake_by_address_all((void*)&pending._value);
+        }
+      } else if (promise._detached) {
+        handle.destroy();
+      }
+      return std::noop_coroutine();
+    }
+    void await_resume() noexcept {}
+  };
+
+  //---
+  TaskPromiseBase()
+  {
+    _counter = nullptr;
+    _detached = false;
+  }
+
+  //---
+  static void* operator new(u64 size);
+  static void operator delete(void* frame,
+                              u64 size);
+
+  //---
+  std::suspend_always initial_suspend() noexcept { return {}; }
+  FinalAwaiter final_suspend() noexcept { return {}; }
+  void unhandled_exception() { get_errors().fatal(u8"Unhandled exception in coroutine."); }
+};
+
+//---
+template <typename T>
+struct TaskPromise : TaskPromiseBase
+{
+  //---
+  T _value;
+
+  //---
+  void return_value(const T& value) { _value = value; }
+  T get_result() { return _value; }
+};
+
+//---
+template <>
+struct TaskPromise<void> : TaskPromiseBase
+{
+  //---
+  void return_void() {}
+  void get_result() {}
+};
+}
+
+namespace Pathlib {
+
+//---
+template <typename T = void>
+struct Task
+{
+  //---
+  struct promise_type : _Internal::TaskPromise<T>
+  {
+    Task get_return_object() { return Task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+  };
+
+  //---
+  std::coroutine_handle<promise_type> _handle;
+
+  //---
+  DISALLOW_COPY_CONSTRUCTOR(Task);
+  explicit Task(std::coroutine_handle<promise_type> handle) : _handle(handle) {}
+  Task(Task&& other) : _handle(other._handle)
+  {
+    other._handle = nullptr;
+  }
+  ~Task()
+  {
+    if (_handle) {
+      _handle.destroy();
+    }
+  }
+
+  //---
+  inline bool is_done() const
+  {
+    return (!_handle || _handle.done());
+  }
+
+  //---
+  inline void detach()
+  {
+    _handle.promise()._detached = true;
+    get_threadpool().submit(_Internal::resume_coroutine, _handle.address());
+    _handle = nullptr;
+  }
+
+  //---
+  bool await_ready() const { return is_done(); }
+  std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting)
+  {
+    _handle.promise()._continuation = awaiting;
+    return _handle;
+  }
+  decltype(auto) await_resume() { return _handle.promise().get_result(); }
+};
+
+//---
+struct SwitchToThreadpool
+{
+  bool await_ready() const { return false; }
+  void await_suspend(std::coroutine_handle<> handle) const
+  {
+    get_threadpool().submit(_Internal::resume_coroutine, handle.address());
+  }
+  void await_resume() const {}
+};
+
+//---
+inline SwitchToThreadpool switch_to_threadpool()
+{
+  return {};
+}
+
+//---
+struct SleepFor
+{
+  u64 _deadline_ms;
+  bool await_ready() const { return (_deadline_ms <= get_timer().now_ms()); }
+  void await_suspend(std::coroutine_handle<> handle) const;
+  void await_resume() const {}
+};
+
+//---
+inline SleepFor sleep_for(u64 milliseconds)
+{
+  return { get_timer().now_ms() + milliseconds };
+}
+
+//---
+template <typename T>
+decltype(auto) sync_wait(Task<T>& task)
+{
+  JobCounter counter;
+  counter._pending.store(1, MemOrder::RELAXED);
+  task._handle.promise()._counter = &counter;
+  get_threadpool().submit(_Internal::resume_coroutine, task._handle.address());
+  get_threadpool().wait(counter);
+  return task._handle.promise().get_result();
+}
+}
+
+//---
+namespace Pathlib { _Internal::CoroutineFrames& get_coroutine_frames(); }
+namespace Pathlib { _Internal::Sleepers& get_sleepers(); }
\ No newline at end of file
@@ -8,6 +8,30 @@
 
 namespace Pathlib {
 
+//---
+struct ThreadOptions
+{
+  //---
+  static constexpr u64 DEFAULT_STACK_SIZE = 0;
+  static constexpr u64 ANY_PROCESSOR = 0;
+  static constexpr u32 ANY_NUMA_NODE = Types::U32_MAX;
+
+  //---
+  u64 _stack_size;
+  u64 _affinity_mask;
+  u16 _processor_group;
+  u32 _numa_node;
+
+  //---
+  ThreadOptions()
+  {
+    _stack_size = DEFAULT_STACK_SIZE;
+    _affinity_mask = ANY_PROCESSOR;
+    _processor_group = 0;
+    _numa_node = ANY_NUMA_NODE;
+  }
+};
+
 //---
 struct Thread
 {
@@ -31,7 +55,11 @@ struct Thread
 
   //---
   bool spawn(void* user_data,
-             ulong(*thread_function)(void* user_data));
+             ulong(*thread_function)(void* user_data),
+             const ThreadOptions& options = ThreadOptions());
+  bool set_affinity(u64 affinity_mask,
+                    u16 processor_group = 0);
+  bool set_numa_node(u32 numa_node);
   bool join(u32 timeout = INFINITE_TIMEOUT,
             ulong* exit_code = nullptr);
   bool terminate();
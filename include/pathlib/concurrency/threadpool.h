@@ -4,6 +4,58 @@
 
 #pragma once
 #include "pathlib/types/types.h"
+#include "pathlib/concurrency/atomic.h"
+#include "pathlib/concurrency/thread.h"
+#include "pathlib/concurrency/stealing_deque.h"
+
+namespace Pathlib {
+
+//---
+typedef void(*JobFunction)(void* user_data);
+
+//---
+struct JobCounter
+{
+  //---
+  Atomic<u32> _pending;
+
+  //---
+  DISALLOW_COPY(JobCounter);
+  JobCounter()
+  {
+    _pending.store(0);
+  }
+  ~JobCounter() {}
+
+  //---
+  inline bool is_done()
+  {
+    return (_pending.load(MemOrder::ACQUIRE) == 0);
+  }
+};
+
+//---
+struct Job
+{
+  //---
+  JobFunction _function;
+  void* _user_data;
+  JobCounter* _counter;
+};
+
+//---
+struct ThreadpoolOptions
+{
+  //---
+  bool _pin_workers;
+
+  //---
+  ThreadpoolOptions()
+  {
+    _pin_workers = true;
+  }
+};
+}
 
 namespace Pathlib::_Internal {
 
@@ -12,6 +64,54 @@ struct Threadpool
 {
   //---
   static constexpr u32 MAX_THREAD_COUNT = 512;
+  static constexpr u32 JOB_CAPACITY = 2048;
+  static constexpr u32 SPINS_BEFORE_PARKING = 256;
+  static constexpr u32 NOT_A_WORKER = Types::U32_MAX;
+
+  //---
+  struct Worker
+  {
+    //---
+    StealingDeque<Job, JOB_CAPACITY> _jobs;
+    Thread _thread;
+    Threadpool* _pool;
+    u32 _index;
+    u32 _random_state;
+  };
 
+  //---
+  alignas(CACHE_LINE_SIZE) StealingDeque<Job, JOB_CAPACITY> _shared_jobs;
+  AtomicFlag _shared_lock;
+  alignas(CACHE_LINE_SIZE) Atomic<u32> _wake_epoch;
+  Atomic<u32> _sleeping_count;
+  Atomic<u32> _running;
+  Worker* _workers;
+  u32 _worker_count;
+
+  //---
+  DISALLOW_COPY(Threadpool);
+  Threadpool();
+  ~Threadpool();
+
+  //---
+  bool submit(JobFunction function,
+              void* user_data,
+              JobCounter* counter = nullptr);
+  void wait(JobCounter& counter);
+  u32 get_thread_count() const;
+  u32 get_current_worker_index() const;
+
+  //---
+  bool find_job(u32 worker_index,
+                u32& random_state,
+                Job& job_out);
+  void execute(const Job& job);
+  bool has_work();
+  void wake_one();
+  void park();
 };
-}
\ No newline at end of file
+}
+
+//---
+namespace Pathlib { _Internal::Threadpool& get_threadpool(); }
+namespace Pathlib { bool set_threadpool_options(const ThreadpoolOptions& options); }
\ No newline at end of file
@@ -0,0 +1,360 @@
+/*
+  Documentation: https://www.path.blog/docs/hashmap.html
+*/
+
+#pragma once
+#include "pathlib/types/types.h"
+#include "pathlib/math/math.h"
+#include "pathlib/math/simd_math.h"
+#include "pathlib/concurrency/atomic.h"
+#include "pathlib/concurrency/spinlock.h"
+#include "pathlib/concurrency/epoch.h"
+#include "pathlib/memory/memory.h"
+#include "pathlib/memory/malloc_unsafe.h"
+#include "pathlib/memory/memset_unsafe.h"
+#include "pathlib/string/string_unsafe.h"
+#include "pathlib/string/compare.h"
+#include "pathlib/errors/errors.h"
+#include "pathlib/string/fixed_string_unsafe.h"
+
+namespace Pathlib {
+
+//---
+template <typename K,
+          typename V,
+          u32 SHARD_COUNT = 64,
+          u32 SHARD_RESERVE_CAPACITY = 64>
+struct ConcurrentHashmap
+{
+  //---
+  static_assert(Math::is_pot(SHARD_COUNT), "ConcurrentHashmap SHARD_COUNT must be a power of two.");
+  static_assert(Math::is_pot(SHARD_RESERVE_CAPACITY) && (SHARD_RESERVE_CAPACITY >= 8),
+                "ConcurrentHashmap SHARD_RESERVE_CAPACITY must be a power of two, greater or equal to 8.");
+  static_assert(IS_TRIVIALLY_COPYABLE(K) && IS_TRIVIALLY_COPYABLE(V), 
+                "ConcurrentHashmap keys and values must be trivially copyable; readers access them optimistically.");
+
+  //---
+  static u32 constexpr EMPTY_SLOT = 0;
+  static u32 constexpr TOMBSTONE = 1;
+  static u32 constexpr OCCUPIED = 0x80000000;
+  static u32 constexpr NOT_FOUND = Types::U32_MAX;
+  static u32 constexpr MIGRATE_BATCH = 64;
+  static u32 constexpr MAX_OPTIMISTIC_READS = 8;
+
+  //---
+  struct Table
+  {
+    u32* _digests;
+    K* _keys;
+    V* _values;
+    u32 _capacity;
+    u32 _used;
+  };
+
+  //---
+  struct alignas(CACHE_LINE_SIZE) Shard
+  {
+    Atomic<u32> _version;
+    Atomic<u64> _table;
+    Atomic<u64> _old_table;
+    u32 _migrate_slot;
+    u32 _count;
+    Spinlock _lock;
+  };
+
+  //---
+  Shard _shards[SHARD_COUNT];
+  FixedStringUnsafe<64> _name;
+
+  //---
+  DISALLOW_COPY(ConcurrentHashmap);
+
+  //---
+  explicit ConcurrentHashmap(const MemoryName& name) : _name(name())
+  {
+    for (u32 s = 0; s < SHARD_COUNT; ++s) {
+      Shard& shard = _shards[s];
+      shard._version.store(0, MemOrder::RELAXED);
+      shard._table.store((u64)create_table(SHARD_RESERVE_CAPACITY), MemOrder::RELAXED);
+      shard._old_table.store(0, MemOrder::RELAXED);
+      shard._migrate_slot = 0;
+      shard._count = 0;
+    }
+    atomic_fence(MemOrder::RELEASE);
+  }
+
+  //---
+  ~ConcurrentHashmap()
+  {
+    for (u32 s = 0; s < SHARD_COUNT; ++s) {
+      Shard& shard = _shards[s];
+      Table* old_table = (Table*)shard._old_table.load(MemOrder::ACQUIRE);
+      if (old_table) {
+        destroy_table(old_table);
+      }
+      destroy_table((Table*)shard._table.load(MemOrder::ACQUIRE));
+    }
+  }
+
+  //---
+  template <typename T>
+  static inline u32 hash(const T& key)
+  {
+    if constexpr (IS_INTEGRAL(T) || IS_FLOAT(T)) {
+      return Math::hash(key);
+    } else if constexpr (IS_SAFE_FIXED_STRING(T) || IS_UNSAFE_FIXED_STRING(T) ||
+                         IS_SAFE_STRING(T) || IS_UNSAFE_STRING(T)) {
+      return key.hash();
+    } else if constexpr (SAME_TYPE(T, const utf8*)) {
+      return StringUnsafe<64>::hash(key);
+    } else {
+      static_assert(false, "Unsupported type used for hashmap key.");
+    }
+  }
+
+  //---
+  static inline bool keys_equal(const K& first,
+                                const K& second)
+  {
+    if constexpr (SAME_TYPE(K, const utf8*)) {
+      return strcmp(first, second);
+    } else {
+      return (first == second);
+    }
+  }
+
+  //---
+  inline bool find(const K& key,
+                   V& value_out)
+  {
+    u32 key_hash = hash(key);
+    Shard& shard = _shards[key_hash & (SHARD_COUNT - 1)];
+    EpochGuard epoch_guard;
+    for (u32 r = 0; r < MAX_OPTIMISTIC_READS; ++r) {
+      u32 version = shard._version.load(MemOrder::ACQUIRE);
+      if (DONT_EXPECT(version & 1)) {
+        __builtin_ia32_pause();
+        continue;
+      }
+      bool found = find_in_shard(shard, key, key_hash, value_out);
+      atomic_fence(MemOrder::ACQUIRE);
+      if (EXPECT(shard._version.load(MemOrder::RELAXED) == version)) {
+        return found;
+      }
+    }
+    shard._lock.acquire();
+    bool found = find_in_shard(shard, key, key_hash, value_out);
+    shard._lock.release();
+    return found;
+  }
+
+  //---
+  inline bool insert(const K& key,
+                     const V& value)
+  {
+    u32 key_hash = hash(key);
+    Shard& shard = _shards[key_hash & (SHARD_COUNT - 1)];
+    shard._lock.acquire();
+    shard._version.fetch_add(1, MemOrder::ACQ_REL);
+    migrate_step(shard);
+    Table* table = (Table*)shard._table.load(MemOrder::RELAXED);
+    u32 slot = find_slot(table, key, key_hash);
+    if (slot != NOT_FOUND) {
+      table->_values[slot] = value;
+    } else {
+      Table* old_table = (Table*)shard._old_table.load(MemOrder::RELAXED);
+      u32 old_slot = old_table ? find_slot(old_table, key, key_hash) : NOT_FOUND;
+      if (old_slot != NOT_FOUND) {
+        __atomic_store_n(&old_table->_digests[old_slot], TOMBSTONE, MemOrder::RELEASE);
+      } else {
+        ++shard._count;
+      }
+      if (((table->_used + 1) << 2) > (table->_capacity * 3)) {
+        table = grow(shard);
+      }
+      insert_into(table, key, key_hash, value);
+    }
+    shard._version.fetch_add(1, MemOrder::RELEASE);
+    shard._lock.release();
+    return true;
+  }
+
+  //---
+  inline bool remove(const K& key)
+  {
+    u32 key_hash = hash(key);
+    Shard& shard = _shards[key_hash & (SHARD_COUNT - 1)];
+    shard._lock.acquire();
+    shard._version.fetch_add(1, MemOrder::ACQ_REL);
+    migrate_step(shard);
+    bool removed = false;
+    Table* tables[2] = { (Table*)shard._table.load(MemOrder::RELAXED),
+                         (Table*)shard._old_table.load(MemOrder::RELAXED) };
+    for (u32 t = 0; t < 2; ++t) {
+      if (tables[t]) {
+        u32 slot = find_slot(tables[t], key, key_hash);
+        if (slot != NOT_FOUND) {
+          __atomic_store_n(&tables[t]->_digests[slot], TOMBSTONE, MemOrder::RELEASE);
+          removed = true;
+        }
+      }
+    }
+    if (removed) {
+      --shard._count;
+    }
+    shard._version.fetch_add(1, MemOrder::RELEASE);
+    shard._lock.release();
+    return removed;
+  }
+
+  //---
+  inline u64 get_count()
+  {
+    u64 count = 0;
+    for (u32 s = 0; s < SHARD_COUNT; ++s) {
+      count += __atomic_load_n(&_shards[s]._count, MemOrder::RELAXED);
+    }
+    return count;
+  }
+
+  //---
+  Table* create_table(u32 capacity)
+  {
+    Table* table = (Table*)malloc_unsafe(sizeof(Table), FixedStringUnsafe<64>(u8"\"", _name._str, u8"\"::_table")._str);
+    table->_digests = (u32*)malloc_unsafe(sizeof(u32) * capacity,
+                                          FixedStringUnsafe<64>(u8"\"", _name._str, u8"\"::_digests")._str);
+    table->_keys = (K*)malloc_unsafe(sizeof(K) * capacity,
+                                     FixedStringUnsafe<64>(u8"\"", _name._str, u8"\"::_keys")._str);
+    table->_values = (V*)malloc_unsafe(sizeof(V) * capacity,
+                                       FixedStringUnsafe<64>(u8"\"", _name._str, u8"\"::_values")._str);
+    memset_unsafe(table->_digests, EMPTY_SLOT, sizeof(u32) * capacity);
+    table->_capacity = capacity;
+    table->_used = 0;
+    return table;
+  }
+
+  //---
+  static void destroy_table(void* ptr)
+  {
+    Table* table = (Table*)ptr;
+    free_unsafe((void**)&table->_digests);
+    free_unsafe((void**)&table->_keys);
+    free_unsafe((void**)&table->_values);
+    free_unsafe((void**)&table);
+  }
+
+  //---
+  static inline u32 find_slot(Table* table,
+                              const K& key,
+                              u32 key_hash)
+  {
+    I8 key_digest = I8_SET1(key_hash | OCCUPIED);
+    I8 empty_slot = I8_SET1(EMPTY_SLOT);
+    u32 slot = Math::hash(key_hash) & (table->_capacity - 8);
+    for (u32 g = 0; g < (table->_capacity >> 3); ++g) {
+      I8 digests = I8_LOADU(&table->_digests[slot]);
+      atomic_fence(MemOrder::ACQUIRE);
+      u32 digest_mask = I8_MOVEMASK(I8_CMP_EQ(key_digest, digests));
+      while (digest_mask) {
+        u32 lane = Math::lsb_set(digest_mask) >> 2;
+        if (keys_equal(table->_keys[slot + lane], key)) {
+          return (slot + lane);
+        }
+        digest_mask ^= (0xF << (lane << 2));
+      }
+      if (I8_MOVEMASK(I8_CMP_EQ(empty_slot, digests))) {
+        return NOT_FOUND;
+      }
+      slot = (slot + 8) & (table->_capacity - 1);
+    }
+    return NOT_FOUND;
+  }
+
+  //---
+  static inline void insert_into(Table* table,
+                                 const K& key,
+                                 u32 key_hash,
+                                 const V& value)
+  {
+    I8 empty_slot = I8_SET1(EMPTY_SLOT);
+    I8 tombstone = I8_SET1(TOMBSTONE);
+    u32 slot = Math::hash(key_hash) & (table->_capacity - 8);
+    for (u32 g = 0; g < (table->_capacity >> 3); ++g) {
+      I8 digests = I8_LOADU(&table->_digests[slot]);
+      u32 free_mask = I8_MOVEMASK(I8_CMP_EQ(empty_slot, digests)) | I8_MOVEMASK(I8_CMP_EQ(tombstone, digests));
+      if (free_mask) {
+        u32 insert_index = slot + (Math::lsb_set(free_mask) >> 2);
+        table->_used += (table->_digests[insert_index] == EMPTY_SLOT);
+        table->_keys[insert_index] = key;
+        table->_values[insert_index] = value;
+        __atomic_store_n(&table->_digests[insert_index], key_hash | OCCUPIED, MemOrder::RELEASE);
+        return;
+      }
+      slot = (slot + 8) & (table->_capacity - 1);
+    }
+    /* Unreachable while the load factor holds; a full table here would silently lose the entry. */
+    get_errors().fatal(u8"ConcurrentHashmap insert found no free slot; the table is full.");
+  }
+
+  //---
+  inline bool find_in_shard(Shard& shard,
+                            const K& key,
+                            u32 key_hash,
+                            V& value_out)
+  {
+    Table* table = (Table*)shard._table.load(MemOrder::ACQUIRE);
+    u32 slot = find_slot(table, key, key_hash);
+    if (slot != NOT_FOUND) {
+      value_out = table->_values[slot];
+      return true;
+    }
+    Table* old_table = (Table*)shard._old_table.load(MemOrder::ACQUIRE);
+    if (old_table) {
+      slot = find_slot(old_table, key, key_hash);
+      if (slot != NOT_FOUND) {
+        value_out = old_table->_values[slot];
+        return true;
+      }
+    }
+    return false;
+  }
+
+  //---
+  inline void migrate_step(Shard& shard,
+                           u32 batch = MIGRATE_BATCH)
+  {
+    Table* old_table = (Table*)shard._old_table.load(MemOrder::RELAXED);
+    if (!old_table) {
+      return;
+    }
+    Table* table = (Table*)shard._table.load(MemOrder::RELAXED);
+    u32 end = Math::min(shard._migrate_slot + batch, old_table->_capacity);
+    for (u32 s = shard._migrate_slot; s < end; ++s) {
+      if (old_table->_digests[s] & OCCUPIED) {
+        insert_into(table, old_table->_keys[s], hash(old_table->_keys[s]), old_table->_values[s]);
+      }
+    }
+    shard._migrate_slot = end;
+    if (end == old_table->_capacity) {
+      shard._old_table.store(0, MemOrder::RELEASE);
+      get_epochs().retire(old_table, destroy_table);
+    }
+  }
+
+  //---
+  inline Table* grow(Shard& shard)
+  {
+    Table* old_table = (Table*)shard._old_table.load(MemOrder::RELAXED);
+    if (old_table) {
+      migrate_step(shard, old_table->_capacity);
+    }
+    Table* table = (Table*)shard._table.load(MemOrder::RELAXED);
+    u32 capacity = ((shard._count << 1) >= table->_capacity) ? (table->_capacity << 1) : table->_capacity;
+    Table* new_table = create_table(capacity);
+    shard._migrate_slot = 0;
+    shard._old_table.store((u64)table, MemOrder::RELEASE);
+    shard._table.store((u64)new_table, MemOrder::RELEASE);
+    return new_table;
+  }
+};
+}
\ No newline at end of file
@@ -13,7 +13,8 @@ namespace Pathlib {
 //---
 template <typename K, 
           typename V, 
-          u64 RESERVE_CAPACITY>
+          u64 RESERVE_CAPACITY,
+          typename ALLOCATOR = MallocAllocator>
 struct HashmapUnsafe
 {
   //---
@@ -34,19 +35,25 @@ struct HashmapUnsafe
   u32 _max_probe_length;
   u32* _slot_kv_index;
   u32* _slot_distance_digest;
-  VectorUnsafe<K, RESERVE_CAPACITY> _keys;
-  VectorUnsafe<V, RESERVE_CAPACITY> _values;
-  VectorUnsafe<u32, RESERVE_CAPACITY> _kv_slot_lookup;
+  NO_UNIQUE_ADDRESS ALLOCATOR _allocator;
+  VectorUnsafe<K, RESERVE_CAPACITY, ALLOCATOR> _keys;
+  VectorUnsafe<V, RESERVE_CAPACITY, ALLOCATOR> _values;
+  VectorUnsafe<u32, RESERVE_CAPACITY, ALLOCATOR> _kv_slot_lookup;
 
   //---
-  explicit HashmapUnsafe(const MemoryName& name)
+  explicit HashmapUnsafe(const MemoryName& name,
+                         const ALLOCATOR& allocator = ALLOCATOR())
+    : _allocator(allocator),
+      _keys(FixedStringUnsafe<64>(name(), u8"::_keys")._str, RESERVE_CAPACITY, allocator),
+      _values(FixedStringUnsafe<64>(name(), u8"::_values")._str, RESERVE_CAPACITY, allocator),
+      _kv_slot_lookup(FixedStringUnsafe<64>(name(), u8"::_kv_slot_lookup")._str, RESERVE_CAPACITY, allocator)
   {
     _capacity = RESERVE_CAPACITY;
     _max_probe_length = 1 + (Math::log2(_capacity) >> 2);
-    _slot_kv_index = (u32*)malloc_unsafe(sizeof(u32) * _capacity, 
-                                         FixedStringUnsafe<64>(u8"\"", name(), u8"\"::_slot_kv_index")._str);
-    _slot_distance_digest = (u32*)malloc_unsafe(sizeof(u32) * _capacity, 
-                                                FixedStringUnsafe<64>(u8"\"", name(), u8"\"::_slot_distance_digest")._str);
+    _slot_kv_index = (u32*)_allocator.allocate(sizeof(u32) * _capacity, 
+                                               FixedStringUnsafe<64>(u8"\"", name(), u8"\"::_slot_kv_index")._str);
+    _slot_distance_digest = (u32*)_allocator.allocate(sizeof(u32) * _capacity, 
+                                                      FixedStringUnsafe<64>(u8"\"", name(), u8"\"::_slot_distance_digest")._str);
     I8 empty_slot = I8_SET1(EMPTY_SLOT);
     for (u32 r = 0; r < (_capacity >> 3); ++r) {
       I8_STORE(&((I8*)_slot_distance_digest)[r], empty_slot);
@@ -60,10 +67,12 @@ struct HashmapUnsafe
   ~HashmapUnsafe()
   {
     if (_slot_kv_index) {
-      free_unsafe((void**)&_slot_kv_index);
+      _allocator.free(_slot_kv_index, sizeof(u32) * _capacity);
+      _slot_kv_index = nullptr;
     }
     if (_slot_distance_digest) {
-      free_unsafe((void**)&_slot_distance_digest);
+      _allocator.free(_slot_distance_digest, sizeof(u32) * _capacity);
+      _slot_distance_digest = nullptr;
     }
   }
   
@@ -224,12 +233,15 @@ struct HashmapUnsafe
   //---
   inline bool rebuild_larger()
   {
+    u32 old_capacity = _capacity;
     _capacity <<= 1;
     _max_probe_length = 1 + (Math::log2(_capacity) >> 2);
-    _slot_kv_index = (u32*)realloc_unsafe(_slot_kv_index, 
-                                         sizeof(u32) * _capacity);
-    _slot_distance_digest = (u32*)realloc_unsafe(_slot_distance_digest, 
-                                                sizeof(u32) * _capacity);
+    _slot_kv_index = (u32*)_allocator.reallocate(_slot_kv_index, 
+                                                 sizeof(u32) * old_capacity,
+                                                 sizeof(u32) * _capacity);
+    _slot_distance_digest = (u32*)_allocator.reallocate(_slot_distance_digest, 
+                                                        sizeof(u32) * old_capacity,
+                                                        sizeof(u32) * _capacity);
     I8 empty_slot = I8_SET1(EMPTY_SLOT);
     for (u32 r = 0; r < (_capacity >> 3); ++r) {
       I8_STORE(&((I8*)_slot_distance_digest)[r], empty_slot);
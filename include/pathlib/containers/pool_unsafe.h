@@ -7,6 +7,7 @@
 #include "pathlib/errors/errors.h"
 #include "pathlib/memory/memory.h"
 #include "pathlib/memory/memset_unsafe.h"
+#include "pathlib/memory/allocators.h"
 #include "pathlib/string/fixed_string_unsafe.h"
 
 //---
@@ -16,7 +17,8 @@ namespace Pathlib {
 
 //---
 template <typename T, 
-          u32 CAPACITY>
+          u32 CAPACITY,
+          typename ALLOCATOR = MallocAllocator>
 struct PoolUnsafe
 {
   //---
@@ -34,16 +36,19 @@ struct PoolUnsafe
   u32 _free_count;
   u32 _free_head;
   u32 _pools_id;
+  NO_UNIQUE_ADDRESS ALLOCATOR _allocator;
 
   //---
   explicit PoolUnsafe(const MemoryName& name,
-                      u32 pools_id = 0) 
+                      u32 pools_id = 0,
+                      const ALLOCATOR& allocator = ALLOCATOR()) 
+    : _allocator(allocator)
   {
     _count = 0;
     _free_count = 1;
     _free_head = 0;
     _pools_id = pools_id;
-    _data = (T*)malloc_unsafe(sizeof(T) * CAPACITY, FixedStringUnsafe<64>(u8"\"", name(), u8"\"::_data")._str);
+    _data = (T*)_allocator.allocate(sizeof(T) * CAPACITY, FixedStringUnsafe<64>(u8"\"", name(), u8"\"::_data")._str);
     memset_unsafe(_data, 0xFF, sizeof(T) * CAPACITY);
   }
 
@@ -58,7 +63,8 @@ struct PoolUnsafe
         return true;
       });
     if (_data) {
-      free_unsafe((void**)&_data);
+      _allocator.free(_data, sizeof(T) * CAPACITY);
+      _data = nullptr;
     }
   }
 
@@ -140,7 +140,7 @@ public:
   }
 
   //---
-  SafePtr& operator =(const T* ptr)
+  SafePtr& operator =(const T* ptr) requires (!SAME_TYPE(T, const T))
   {
     _ptr = _offset_ptr = ptr;
     if (ptr == nullptr) {
@@ -127,5 +127,11 @@ public:
   {
     return _count;
   }
+
+  //---
+  inline T* get_data()
+  {
+    return _data;
+  }
 };
 }
\ No newline at end of file
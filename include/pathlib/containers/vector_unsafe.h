@@ -5,27 +5,32 @@
 #pragma once
 #include "pathlib/types/types.h"
 #include "pathlib/memory/memcpy.h"
+#include "pathlib/memory/allocators.h"
 #include "pathlib/string/fixed_string_unsafe.h"
 
 namespace Pathlib {
 
 //---
 template <typename T, 
-          u64 RESERVE_CAPACITY>
+          u64 RESERVE_CAPACITY,
+          typename ALLOCATOR = MallocAllocator>
 struct VectorUnsafe
 {
   //---
   T* _data;
   u64 _count;
   u64 _capacity;
+  NO_UNIQUE_ADDRESS ALLOCATOR _allocator;
 
   //---
   VectorUnsafe(const utf8* name,
-               u64 reserve_capacity = RESERVE_CAPACITY)
+               u64 reserve_capacity = RESERVE_CAPACITY,
+               const ALLOCATOR& allocator = ALLOCATOR())
+    : _allocator(allocator)
   {
     _capacity = reserve_capacity;
-    _data = (T*)malloc_unsafe(sizeof(T) * reserve_capacity,
-                              name ? FixedStringUnsafe<64>(u8"\"", name, u8"\"::_data")._str : nullptr);
+    _data = (T*)_allocator.allocate(sizeof(T) * reserve_capacity,
+                                    name ? FixedStringUnsafe<64>(u8"\"", name, u8"\"::_data")._str : nullptr);
     clear();
   }
 
@@ -37,7 +42,8 @@ struct VectorUnsafe
   {
     for (u64 c = 0; c < _count; ++c) {
     }
-    free_unsafe((void**)&_data);
+    _allocator.free(_data, sizeof(T) * _capacity);
+    _data = nullptr;
   }
 
   //---
@@ -60,8 +66,9 @@ struct VectorUnsafe
     u64 original_count = _count;
     _count += count;
     if (_count > _capacity) {
+      u64 old_capacity = _capacity;
       _capacity = _count * 1.5;
-      _data = (T*)realloc_unsafe(_data, sizeof(T) * _capacity);
+      _data = (T*)_allocator.reallocate(_data, sizeof(T) * old_capacity, sizeof(T) * _capacity);
     }
     return (_data + original_count);
   }
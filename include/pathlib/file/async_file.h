@@ -0,0 +1,120 @@
+/*
+  Documentation: https://www.path.blog/docs/file.html
+*/
+
+#pragma once
+#include "pathlib/types/types.h"
+#include "pathlib/concurrency/atomic.h"
+#include "pathlib/concurrency/thread.h"
+#include "pathlib/concurrency/coroutine.h"
+#include "pathlib/win32/safe_win32.h"
+
+namespace Pathlib {
+
+//---
+struct FileRequest;
+typedef void(*FileCallback)(FileRequest& request);
+
+//---
+struct FileRequest
+{
+  //---
+  static constexpr u32 OVERLAPPED_SIZE = 32;
+
+  //---
+  alignas(8) u8 _overlapped[OVERLAPPED_SIZE];
+  void* _buffer;
+  u64 _offset;
+  u32 _size;
+  u32 _bytes_transferred;
+  u32 _error;
+  FileCallback _callback;
+  void* _user_data;
+  void* _coroutine;
+};
+
+//---
+struct AsyncFile
+{
+  //---
+  static constexpr u32 READ = 0x1;
+  static constexpr u32 WRITE = 0x2;
+
+  //---
+  struct Awaiter
+  {
+    AsyncFile* _file;
+    FileRequest _request;
+    bool _is_write;
+
+    bool await_ready() const { return false; }
+    bool await_suspend(std::coroutine_handle<> handle);
+    u32 await_resume() const { return _request._bytes_transferred; }
+  };
+
+  //---
+  HANDLE _handle;
+  u64 _size;
+
+  //---
+  DISALLOW_COPY(AsyncFile);
+  AsyncFile();
+  ~AsyncFile();
+
+  //---
+  bool open(const utf8* path,
+            u32 mode = READ);
+  void close();
+  bool read(FileRequest& request,
+            u64 offset,
+            void* buffer,
+            u32 size,
+            FileCallback callback,
+            void* user_data = nullptr);
+  bool write(FileRequest& request,
+             u64 offset,
+             const void* buffer,
+             u32 size,
+             FileCallback callback,
+             void* user_data = nullptr);
+  Awaiter read_async(u64 offset,
+                     void* buffer,
+                     u32 size);
+  Awaiter write_async(u64 offset,
+                      const void* buffer,
+                      u32 size);
+  inline u64 get_size() const { return _size; }
+
+  //---
+  bool submit(FileRequest& request,
+              bool is_write);
+};
+}
+
+namespace Pathlib::_Internal {
+
+//---
+struct AsyncIO
+{
+  //---
+  static constexpr u32 COMPLETION_BATCH = 64;
+  static constexpr u64 SHUTDOWN_KEY = Types::U64_MAX;
+
+  //---
+  HANDLE _port;
+  Thread _thread;
+  alignas(CACHE_LINE_SIZE) Atomic<u32> _in_flight;
+
+  //---
+  DISALLOW_COPY(AsyncIO);
+  AsyncIO();
+  ~AsyncIO();
+
+  //---
+  bool attach(HANDLE file);
+  void complete(FileRequest& request);
+};
+}
+
+//---
+namespace Pathlib { _Internal::AsyncIO& get_async_io(); }
\ No newline at end of file
@@ -0,0 +1,77 @@
+/*
+  Documentation: https://www.path.blog/docs/file.html
+*/
+
+#pragma once
+#include "pathlib/types/types.h"
+#include "pathlib/containers/safe_ptr.h"
+#include "pathlib/math/math.h"
+#include "pathlib/win32/safe_win32.h"
+#include "pathlib/errors/errors.h"
+
+namespace Pathlib {
+
+//---
+struct MappedFile
+{
+  //---
+  static constexpr u32 READ_ONLY = 0x0;
+  static constexpr u32 COPY_ON_WRITE = 0x1;
+  static constexpr u32 ACCESS_NORMAL = 0x0;
+  static constexpr u32 ACCESS_SEQUENTIAL = 0x2;
+  static constexpr u32 ACCESS_RANDOM = 0x4;
+
+  //---
+  HANDLE _file;
+  HANDLE _mapping;
+  u8* _view;
+  u64 _size;
+  bool _copy_on_write;
+
+  //---
+  DISALLOW_COPY(MappedFile);
+  MappedFile();
+  ~MappedFile();
+
+  //---
+  bool open(const utf8* path,
+            u32 flags = READ_ONLY | ACCESS_NORMAL);
+  void close();
+  bool prefetch(u64 offset = 0,
+                u64 size = Types::U64_MAX);
+
+  //---
+  inline SafePtr<const u8> get_view() const
+  {
+    return SafePtr<const u8>(_view, _size);
+  }
+
+  //---
+  inline SafePtr<const u8> get_view(u64 offset,
+                                    u64 size) const
+  {
+    if (DONT_EXPECT(offset >= _size)) {
+      return SafePtr<const u8>(nullptr, 0);
+    }
+    return SafePtr<const u8>(_view + offset, Math::min(size, _size - offset));
+  }
+
+  //---
+  inline SafePtr<u8> get_mutable_view(u64 offset = 0,
+                                      u64 size = Types::U64_MAX) const
+  {
+    /* A READ_ONLY view faults on the first write; refuse to hand one out instead. */
+    if (DONT_EXPECT(!_copy_on_write)) {
+      get_errors().fatal(u8"MappedFile::get_mutable_view() requires a file opened with COPY_ON_WRITE.");
+      return SafePtr<u8>(nullptr, 0);
+    }
+    if (DONT_EXPECT(offset >= _size)) {
+      return SafePtr<u8>(nullptr, 0);
+    }
+    return SafePtr<u8>(_view + offset, Math::min(size, _size - offset));
+  }
+
+  //---
+  inline u64 get_size() const { return _size; }
+};
+}
\ No newline at end of file
@@ -0,0 +1,50 @@
+/*
+  Documentation: https://www.path.blog/docs/malloc.html
+*/
+
+#pragma once
+#include "pathlib/types/types.h"
+#include "pathlib/concurrency/spinlock.h"
+
+namespace Pathlib::_Internal {
+
+//---
+struct AllocationSamples
+{
+  //---
+  static constexpr u32 SAMPLE_RATE = 64;
+  static constexpr u32 RESERVE_CAPACITY = 1024;
+
+  //---
+  struct Sample
+  {
+    u64 _address;
+    u64 _size;
+    u32 _stat_index;
+  };
+
+  //---
+  Sample* _samples;
+  u32 _capacity;
+  u32 _count;
+  Spinlock _lock;
+
+  //---
+  DISALLOW_COPY(AllocationSamples);
+  AllocationSamples();
+  ~AllocationSamples();
+
+  //---
+  void record(const void* ptr,
+              u64 size,
+              u32 stat_index);
+  bool erase(const void* ptr,
+             Sample* sample_out = nullptr);
+
+  //---
+  void grow();
+};
+}
+
+//---
+namespace Pathlib { _Internal::AllocationSamples& get_allocation_samples(); }
\ No newline at end of file
@@ -0,0 +1,154 @@
+/*
+  Documentation: https://www.path.blog/docs/malloc.html
+*/
+
+#pragma once
+#include "pathlib/types/types.h"
+#include "pathlib/memory/malloc_unsafe.h"
+#include "pathlib/memory/memcpy_unsafe.h"
+
+namespace Pathlib {
+
+//---
+struct Heap;
+
+//---
+struct MallocAllocator
+{
+  //---
+  inline void* allocate(u64 size,
+                        const utf8* name)
+  {
+    return malloc_unsafe(size, name);
+  }
+
+  //---
+  inline void* reallocate(void* ptr,
+                          u64 old_size,
+                          u64 new_size)
+  {
+    return realloc_unsafe(ptr, new_size);
+  }
+
+  //---
+  inline void free(void* ptr,
+                   u64 size)
+  {
+    free_unsafe(&ptr);
+  }
+};
+
+//---
+struct ArenaAllocator
+{
+  //---
+  _Internal::Arena* _arena;
+
+  //---
+  ArenaAllocator();
+  explicit ArenaAllocator(_Internal::Arena& arena);
+
+  //---
+  void* allocate(u64 size,
+                 const utf8* name);
+  void* reallocate(void* ptr,
+                   u64 old_size,
+                   u64 new_size);
+
+  //---
+  inline void free(void* ptr,
+                   u64 size) {}
+};
+
+//---
+struct SlabAllocator
+{
+  /* Blocks are aligned to their size class, capped at 64 bytes; 16 and 32-byte classes are weaker than malloc_unsafe's 64. */
+  //---
+  void* allocate(u64 size,
+                 const utf8* name);
+  void* reallocate(void* ptr,
+                   u64 old_size,
+                   u64 new_size);
+  void free(void* ptr,
+            u64 size);
+};
+
+//---
+struct HeapAllocator
+{
+  //---
+  Heap* _heap;
+
+  //---
+  explicit HeapAllocator(Heap& heap);
+
+  //---
+  void* allocate(u64 size,
+                 const utf8* name);
+  void* reallocate(void* ptr,
+                   u64 old_size,
+                   u64 new_size);
+  void free(void* ptr,
+            u64 size);
+};
+
+//---
+template <u64 INLINE_SIZE>
+struct InlineAllocator
+{
+  //---
+  alignas(CACHE_LINE_SIZE) u8 _buffer[INLINE_SIZE];
+  bool _in_use;
+
+  //---
+  InlineAllocator() { _in_use = false; }
+
+  /* Containers take a copy of their allocator; the copy starts with its own empty buffer. */
+  InlineAllocator(const InlineAllocator&) { _in_use = false; }
+
+  /* A container's data may point into _buffer, so the container must not be assigned, moved or relocated (e.g. as a VectorUnsafe element). */
+  InlineAllocator& operator=(const InlineAllocator&) = delete;
+  InlineAllocator(InlineAllocator&&) = delete;
+  InlineAllocator& operator=(InlineAllocator&&) = delete;
+
+  //---
+  inline void* allocate(u64 size,
+                        const utf8* name)
+  {
+    if (!_in_use && (size <= INLINE_SIZE)) {
+      _in_use = true;
+      return _buffer;
+    }
+    return malloc_unsafe(size, name);
+  }
+
+  //---
+  inline void* reallocate(void* ptr,
+                          u64 old_size,
+                          u64 new_size)
+  {
+    if (ptr != _buffer) {
+      return realloc_unsafe(ptr, new_size);
+    }
+    if (new_size <= INLINE_SIZE) {
+      return _buffer;
+    }
+    void* new_ptr = malloc_unsafe(new_size, u8"InlineAllocator overflow");
+    memcpy_unsafe(new_ptr, _buffer, old_size);
+    _in_use = false;
+    return new_ptr;
+  }
+
+  //---
+  inline void free(void* ptr,
+                   u64 size)
+  {
+    if (ptr == _buffer) {
+      _in_use = false;
+    } else {
+      free_unsafe(&ptr);
+    }
+  }
+};
+}
\ No newline at end of file
@@ -2,14 +2,26 @@
 #include "pathlib/types/types.h"
 #include "pathlib/concurrency/atomic.h"
 
-namespace Pathlib::_Internal {
+namespace Pathlib {
+
+//---
+struct ArenaMarker
+{
+  u64 _tail;
+};
+
+namespace _Internal {
 
 //---
 struct Arena
 {
+  //---
+  static constexpr u64 COMMIT_CHUNK_SIZE = 1024 * 1024;
+
   //---
   u8* _head;
   Atomic<u64> _tail;
+  Atomic<u64> _committed;
   u64 _capacity;
 
   //---
@@ -18,10 +30,40 @@ struct Arena
   ~Arena();
 
   //---
-  bool allocate(u64 capacity);
+  bool allocate(u64 capacity,
+                bool large_pages = false);
   void free();
   void* push(u64 size);
+  void* push(u64 size,
+             u64 alignment);
+  void* try_push(u64 size,
+                 u64 alignment = 1);
   void pop(u64 size);
   void clear();
+  ArenaMarker save();
+  void rewind(const ArenaMarker& marker);
+  bool commit(u64 tail);
+
+  //---
+  template <typename T>
+  inline T* push_aligned(u64 count,
+                         u64 alignment = alignof(T))
+  {
+    return (T*)push(sizeof(T) * count, alignment);
+  }
+};
+}
+
+//---
+struct ArenaScope
+{
+  //---
+  _Internal::Arena& _arena;
+  ArenaMarker _marker;
+
+  //---
+  DISALLOW_COPY(ArenaScope);
+  explicit ArenaScope(_Internal::Arena& arena) : _arena(arena), _marker(arena.save()) {}
+  ~ArenaScope() { _arena.rewind(_marker); }
 };
 }
\ No newline at end of file
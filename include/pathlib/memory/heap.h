@@ -0,0 +1,45 @@
+/*
+  Documentation: https://www.path.blog/docs/memory.html
+*/
+
+#pragma once
+#include "pathlib/types/types.h"
+#include "pathlib/memory/memory.h"
+#include "pathlib/string/fixed_string_unsafe.h"
+
+namespace Pathlib {
+
+//---
+struct Heap
+{
+  //---
+  void* _heap;
+  FixedStringUnsafe<64> _name;
+  u32 _owner_thread;
+
+  //---
+  DISALLOW_COPY(Heap);
+  explicit Heap(const MemoryName& name);
+  ~Heap();
+
+  //---
+  [[nodiscard]] void* allocate(u64 size,
+                               const utf8* name = nullptr);
+  [[nodiscard]] void* reallocate(void* ptr,
+                                 u64 size);
+  void destroy();
+  inline bool is_valid() const { return (_heap != nullptr); }
+};
+
+//---
+struct HeapScope
+{
+  //---
+  void* _previous;
+
+  //---
+  DISALLOW_COPY(HeapScope);
+  explicit HeapScope(Heap& heap);
+  ~HeapScope();
+};
+}
\ No newline at end of file
@@ -4,6 +4,19 @@
 
 #pragma once
 #include "pathlib/types/types.h"
+#include "pathlib/concurrency/atomic.h"
+
+//---
+#define MEMORY_TRACKING_OFF 0
+#define MEMORY_TRACKING_SAMPLED 1
+#define MEMORY_TRACKING_FULL 2
+#ifndef MEMORY_TRACKING
+  #ifdef _DEBUG
+    #define MEMORY_TRACKING MEMORY_TRACKING_FULL
+  #else
+    #define MEMORY_TRACKING MEMORY_TRACKING_OFF
+  #endif
+#endif
 
 namespace Pathlib {
 
@@ -14,3 +27,61 @@ void* realloc_unsafe(void* ptr,
                      u64 size);
 void free_unsafe(void** ptr);
 }
+
+namespace Pathlib::_Internal {
+
+//---
+void* heap_malloc_unsafe(void* heap,
+                         u64 size,
+                         const utf8* name);
+void* heap_realloc_unsafe(void* heap,
+                          void* ptr,
+                          u64 size);
+bool heap_register(void* heap);
+void heap_unregister(void* heap);
+void* swap_current_heap(void* heap);
+void heap_forget_blocks(void* heap);
+
+//---
+struct MemoryStats
+{
+  //---
+  static constexpr u32 MAX_NAMES = 1024;
+  static constexpr u32 OVERFLOW_INDEX = MAX_NAMES;
+  static constexpr u32 NAME_SIZE = 48;
+  static constexpr u32 EMPTY = 0;
+  static constexpr u32 WRITING = 1;
+  static constexpr u32 READY = 2;
+
+  //---
+  struct alignas(CACHE_LINE_SIZE) Entry
+  {
+    Atomic<u32> _state;
+    u32 _hash;
+    Atomic<u64> _live_bytes;
+    Atomic<u64> _live_count;
+    Atomic<u64> _peak_bytes;
+    utf8 _name[NAME_SIZE];
+  };
+
+  //---
+  Entry _entries[MAX_NAMES + 1];
+
+  //---
+  DISALLOW_COPY(MemoryStats);
+  MemoryStats();
+  ~MemoryStats() {}
+
+  //---
+  u32 find_or_add(const utf8* name);
+  void add(u32 index,
+           u64 size,
+           u64 count = 1);
+  void sub(u32 index,
+           u64 size,
+           u64 count = 1);
+};
+}
+
+//---
+namespace Pathlib { _Internal::MemoryStats& get_memory_stats(); }
\ No newline at end of file
@@ -5,6 +5,7 @@
 #pragma once
 #include "pathlib/types/types.h"
 #include "pathlib/memory/arena.h"
+#include "pathlib/concurrency/cache_padded.h"
 
 namespace Pathlib {
   
@@ -34,10 +35,15 @@ struct Memory
   static constexpr u32 KILOBYTE = 1024;
   static constexpr u32 MEGABYTE = (1024 * 1024);
   static constexpr u32 GIGABYTE = (1024 * 1024 * 1024);
+  static constexpr u32 MAX_SCRATCH_ARENAS = 512;
+  static constexpr u32 NO_SCRATCH_ARENA = Types::U32_MAX;
+  static constexpr u64 SCRATCH_ARENA_CAPACITY = (64 * MEGABYTE);
 
   //---
   Arena persistent_arena;
-  Arena scoped_arena;
+  CachePadded<Arena> scratch_arenas[MAX_SCRATCH_ARENAS];
+  Atomic<u32> scratch_in_use[MAX_SCRATCH_ARENAS];
+  alignas(CACHE_LINE_SIZE) Atomic<u32> scratch_count;
 
   //---
   Memory();
@@ -45,6 +51,8 @@ struct Memory
 
   //---
   bool enable_large_pages();
+  Arena& get_scratch_arena();
+  void release_scratch_arena();
 };
 }
 }
@@ -13,20 +13,24 @@ template <typename T>
 struct ScopedMemory
 {
   //---
+  _Internal::Arena* _arena;
+  ArenaMarker _marker;
   T* _ptr;
   u64 _count;
 
   //---
   ScopedMemory(u64 count)
   {
-    _ptr = (T*)get_memory().scoped_arena.push(sizeof(T) * count);
+    _arena = &get_memory().get_scratch_arena();
+    _marker = _arena->save();
+    _ptr = _arena->push_aligned<T>(count);
     _count = count;
   }
 
   //---
   ~ScopedMemory()
   {
-    get_memory().scoped_arena.pop(sizeof(T) * _count);
+    _arena->rewind(_marker);
   }
 
   //---
@@ -0,0 +1,87 @@
+/*
+  Documentation: https://www.path.blog/docs/memory.html
+*/
+
+#pragma once
+#include "pathlib/types/types.h"
+#include "pathlib/math/math.h"
+#include "pathlib/concurrency/atomic.h"
+#include "pathlib/concurrency/cache_padded.h"
+#include "pathlib/memory/memory.h"
+
+namespace Pathlib::_Internal {
+
+//---
+struct Slabs
+{
+  //---
+  static constexpr u64 SLAB_SIZE = (64 * 1024);
+  static constexpr u64 SLAB_HEADER_SIZE = CACHE_LINE_SIZE;
+  static constexpr u64 ARENA_CAPACITY = (4ULL * Memory::GIGABYTE);
+  static constexpr u64 MIN_BLOCK_SIZE = 16; /* Blocks below CACHE_LINE_SIZE are only aligned to their own size. */
+  static constexpr u32 SIZE_CLASS_COUNT = 8;
+  static constexpr u64 MAX_BLOCK_SIZE = (MIN_BLOCK_SIZE << (SIZE_CLASS_COUNT - 1));
+  static constexpr u32 MAX_THREAD_CACHES = 512;
+  static constexpr u32 NO_THREAD_CACHE = Types::U32_MAX;
+
+  //---
+  struct FreeBlock
+  {
+    FreeBlock* _next;
+  };
+
+  //---
+  struct SlabHeader
+  {
+    u32 _size_class;
+    u32 _owner;
+  };
+
+  //---
+  struct Magazine
+  {
+    FreeBlock* _free_head;
+    u8* _bump;
+    u8* _bump_end;
+  };
+
+  //---
+  struct ThreadCache
+  {
+    Magazine _magazines[SIZE_CLASS_COUNT];
+    CachePadded<Atomic<u64>> _remote_frees[SIZE_CLASS_COUNT];
+  };
+
+  //---
+  Arena _arena;
+  ThreadCache* _thread_caches[MAX_THREAD_CACHES];
+  Atomic<u32> _thread_cache_in_use[MAX_THREAD_CACHES];
+  alignas(CACHE_LINE_SIZE) Atomic<u32> _thread_cache_count;
+
+  //---
+  DISALLOW_COPY(Slabs);
+  Slabs();
+  ~Slabs();
+
+  //---
+  [[nodiscard]] void* allocate(u64 size);
+  void free(void* ptr);
+  void release_thread_cache();
+
+  //---
+  static inline u32 block_size_class(u64 size)
+  {
+    return (u32)Math::log2(Math::round_up_to_pot(Math::max(size, MIN_BLOCK_SIZE)) / MIN_BLOCK_SIZE);
+  }
+
+  //---
+  u32 get_thread_cache_index();
+  inline bool owns(const void* ptr) const
+  {
+    return (((const u8*)ptr >= _arena._head) && ((const u8*)ptr < (_arena._head + _arena._capacity)));
+  }
+};
+}
+
+//---
+namespace Pathlib { _Internal::Slabs& get_slabs(); }
\ No newline at end of file
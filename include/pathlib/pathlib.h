@@ -6,24 +6,47 @@
 #include "pathlib/win32/console.h"
 #include "pathlib/errors/errors.h"
 #include "pathlib/concurrency/atomic.h"
+#include "pathlib/concurrency/cache_padded.h"
+#include "pathlib/concurrency/sharded_counter.h"
 #include "pathlib/concurrency/spsc_queue.h"
+#include "pathlib/concurrency/spsc_ring.h"
+#include "pathlib/concurrency/disruptor.h"
 #include "pathlib/concurrency/mpsc_queue.h"
+#include "pathlib/concurrency/mpmc_queue.h"
+#include "pathlib/concurrency/lock_free_stack.h"
 #include "pathlib/concurrency/spinlock.h"
+#include "pathlib/concurrency/rw_lock.h"
+#include "pathlib/concurrency/seqlock.h"
+#include "pathlib/concurrency/semaphore.h"
+#include "pathlib/concurrency/latch.h"
+#include "pathlib/concurrency/barrier.h"
+#include "pathlib/concurrency/event.h"
 #include "pathlib/concurrency/thread.h"
+#include "pathlib/concurrency/stealing_deque.h"
+#include "pathlib/concurrency/threadpool.h"
+#include "pathlib/concurrency/parallel.h"
+#include "pathlib/concurrency/coroutine.h"
+#include "pathlib/concurrency/task.h"
+#include "pathlib/concurrency/epoch.h"
+#include "pathlib/concurrency/hazard_pointers.h"
 #include "pathlib/memory/arena.h"
 #include "pathlib/memory/scoped_memory.h"
 #include "pathlib/log/log.h"
 #include "pathlib/math/math.h"
 #include "pathlib/memory/malloc.h"
 #include "pathlib/memory/malloc_unsafe.h"
+#include "pathlib/memory/allocators.h"
 #include "pathlib/memory/memcpy.h"
 #include "pathlib/memory/memset.h"
 #include "pathlib/memory/memory.h"
+#include "pathlib/memory/heap.h"
+#include "pathlib/memory/slabs.h"
 #include "pathlib/containers/safe_ptr.h"
 #include "pathlib/containers/array.h"
 #include "pathlib/containers/array_unsafe.h"
 #include "pathlib/containers/vector.h"
 #include "pathlib/containers/vector_unsafe.h"
+#include "pathlib/containers/concurrent_hashmap.h"
 #include "pathlib/containers/hashmap.h"
 #include "pathlib/containers/hashmap_unsafe.h"
 #include "pathlib/containers/pool.h"
@@ -39,6 +62,9 @@
 #include "pathlib/string/strlen.h"
 #include "pathlib/profiler/profiler.h"
 #include "pathlib/timer/timer.h"
+#include "pathlib/timer/timing_wheel.h"
+#include "pathlib/file/async_file.h"
+#include "pathlib/file/mapped_file.h"
 
 using namespace Pathlib;
 
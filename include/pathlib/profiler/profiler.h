@@ -11,6 +11,15 @@
 
 namespace Pathlib::_Internal {
 
+//---
+struct MemoryStat
+{
+  FixedStringUnsafe<64> _name;
+  u64 _live_bytes;
+  u64 _live_count;
+  u64 _peak_bytes;
+};
+
 //---
 struct Profiler
 {
@@ -19,8 +28,7 @@ struct Profiler
   ~Profiler() {}
 
   //---
-  void list_memory(VectorUnsafe<FixedStringUnsafe<64>, 128>& names_out,
-                   VectorUnsafe<u64, 128>& sizes_out);
+  void list_memory(VectorUnsafe<MemoryStat, 128>& stats_out);
 };
 }
 
@@ -127,8 +127,9 @@ static inline utf8* from_number(T value,
   { \
     u64 new_size = *string_size + DECORATE_SIZE; \
     if (new_size >= *string_capacity) { \
+      u64 old_capacity = *string_capacity; \
       *string_capacity = new_size * 1.5; \
-      *string = (utf8*)realloc_unsafe(*string, *string_capacity); \
+      *string = (utf8*)allocator.reallocate(*string, old_capacity + 1, *string_capacity + 1); \
     } \
     memcpy_unsafe(&(*string)[*string_size], &decorate[DECORATE], DECORATE_SIZE); \
     *string_size = new_size; \
@@ -140,8 +141,9 @@ static inline utf8* from_number(T value,
     utf8* buffer_str = from_number(ARG, buffer, &conversion_size); \
     u64 new_size = *string_size + DECORATE_SIZE + conversion_size; \
     if (new_size >= *string_capacity) { \
+      u64 old_capacity = *string_capacity; \
       *string_capacity = new_size * 1.5; \
-      *string = (utf8*)realloc_unsafe(*string, *string_capacity); \
+      *string = (utf8*)allocator.reallocate(*string, old_capacity + 1, *string_capacity + 1); \
     } \
     memcpy_unsafe(&(*string)[*string_size], &decorate[DECORATE], DECORATE_SIZE); \
     memcpy_unsafe(&(*string)[*string_size + DECORATE_SIZE], buffer_str, conversion_size); \
@@ -236,17 +238,20 @@ static inline void from_type_clip(const T& arg,
 }
 
 //---
-template <typename T>
+template <typename T,
+          typename ALLOCATOR>
 static inline void from_type_grow(const T& arg,
                                   utf8** string,
                                   u64* string_size,
-                                  u64* string_capacity)
+                                  u64* string_capacity,
+                                  ALLOCATOR& allocator)
 {
   if constexpr (SAME_TYPE(T, utf8) || SAME_TYPE(T&, utf8&)) {
     u64 new_size = *string_size + 1;
     if (new_size >= *string_capacity) {
+      u64 old_capacity = *string_capacity;
       *string_capacity = new_size * 1.5;
-      *string = (utf8*)realloc_unsafe(*string, *string_capacity);
+      *string = (utf8*)allocator.reallocate(*string, old_capacity + 1, *string_capacity + 1);
     }
     (*string)[*string_size] = arg;
     (*string)[new_size] = u8'\0';
@@ -256,8 +261,9 @@ static inline void from_type_grow(const T& arg,
     u64 arg_size = strlen(arg);
     u64 new_size = *string_size + arg_size;
     if (new_size >= *string_capacity) {
+      u64 old_capacity = *string_capacity;
       *string_capacity = new_size * 1.5;
-      *string = (utf8*)realloc_unsafe(*string, *string_capacity);
+      *string = (utf8*)allocator.reallocate(*string, old_capacity + 1, *string_capacity + 1);
     }
     memcpy_unsafe(&(*string)[*string_size], arg, arg_size);
     (*string)[new_size] = u8'\0';
@@ -268,8 +274,9 @@ static inline void from_type_grow(const T& arg,
     utf8* buffer_str = from_number(arg, buffer, &conversion_size);
     u64 new_size = *string_size + conversion_size;
     if (new_size >= *string_capacity) {
+      u64 old_capacity = *string_capacity;
       *string_capacity = new_size * 1.5;
-      *string = (utf8*)realloc_unsafe(*string, *string_capacity);
+      *string = (utf8*)allocator.reallocate(*string, old_capacity + 1, *string_capacity + 1);
     }
     memcpy_unsafe(&(*string)[*string_size], buffer_str, conversion_size);
     (*string)[new_size] = u8'\0';
@@ -5,6 +5,7 @@
 #pragma once
 #include "pathlib/types/types.h"
 #include "pathlib/memory/malloc_unsafe.h"
+#include "pathlib/memory/allocators.h"
 #include "pathlib/string/from_type.h"
 #include "pathlib/string/fixed_string.h"
 
@@ -116,7 +117,8 @@ public:
       memcpy_unsafe<false, true>(&string_out._str[string_out._size], arg.get_str(), arg.get_size() + 1);
       string_out._size = new_size;
     } else {
-      _Internal::from_type_grow(arg, &string_out._str, &string_out._size, &string_out._capacity);
+      MallocAllocator allocator;
+      _Internal::from_type_grow(arg, &string_out._str, &string_out._size, &string_out._capacity, allocator);
     }
   }
 
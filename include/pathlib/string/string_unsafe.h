@@ -5,19 +5,22 @@
 #pragma once
 #include "pathlib/types/types.h"
 #include "pathlib/memory/malloc_unsafe.h"
+#include "pathlib/memory/allocators.h"
 #include "pathlib/string/from_type.h"
 #include "pathlib/string/fixed_string_unsafe.h"
 
 namespace Pathlib {
 
 //---
-template <u64 RESERVE_CAPACITY>
+template <u64 RESERVE_CAPACITY,
+          typename ALLOCATOR = MallocAllocator>
 struct StringUnsafe
 {
   //---
   utf8* _str;
   u64 _capacity;
   u64 _size;
+  NO_UNIQUE_ADDRESS ALLOCATOR _allocator;
 
   //---
   template <typename... Args>
@@ -25,7 +28,20 @@ struct StringUnsafe
                         Args&&... args)
   {
     _capacity = RESERVE_CAPACITY;
-    _str = (utf8*)malloc_unsafe(RESERVE_CAPACITY + 1, FixedStringUnsafe<64>(u8"\"", name(), u8"\"::_str")._str);
+    _str = (utf8*)_allocator.allocate(RESERVE_CAPACITY + 1, FixedStringUnsafe<64>(u8"\"", name(), u8"\"::_str")._str);
+    clear();
+    (StringUnsafe::_append(*this, args), ...);
+  }
+
+  //---
+  template <typename... Args>
+  explicit StringUnsafe(const ALLOCATOR& allocator,
+                        const MemoryName& name,
+                        Args&&... args)
+    : _allocator(allocator)
+  {
+    _capacity = RESERVE_CAPACITY;
+    _str = (utf8*)_allocator.allocate(RESERVE_CAPACITY + 1, FixedStringUnsafe<64>(u8"\"", name(), u8"\"::_str")._str);
     clear();
     (StringUnsafe::_append(*this, args), ...);
   }
@@ -37,7 +53,8 @@ struct StringUnsafe
   ~StringUnsafe()
   {
     if (_str) {
-      free_unsafe((void**)&_str);
+      _allocator.free(_str, _capacity + 1);
+      _str = nullptr;
     }
   }
 
@@ -94,21 +111,23 @@ struct StringUnsafe
     if constexpr (IS_UNSAFE_STRING(T) || IS_UNSAFE_FIXED_STRING(T)) {
       u64 new_size = string_out._size + arg._size;
       if (new_size > string_out._capacity) {
+        u64 old_capacity = string_out._capacity;
         string_out._capacity = new_size * 1.5;
-        string_out._str = (utf8*)realloc_unsafe(string_out._str, string_out._capacity + 1);
+        string_out._str = (utf8*)string_out._allocator.reallocate(string_out._str, old_capacity + 1, string_out._capacity + 1);
       }
       memcpy_unsafe<false, true>(&string_out._str[string_out._size], arg._str, arg._size + 1);
       string_out._size = new_size;
     } else if constexpr (IS_SAFE_STRING(T) || IS_SAFE_FIXED_STRING(T)) {
       u64 new_size = string_out._size + arg.get_size();
       if (new_size > string_out._capacity) {
+        u64 old_capacity = string_out._capacity;
         string_out._capacity = new_size * 1.5;
-        string_out._str = (utf8*)realloc_unsafe(string_out._str, string_out._capacity + 1);
+        string_out._str = (utf8*)string_out._allocator.reallocate(string_out._str, old_capacity + 1, string_out._capacity + 1);
       }
       memcpy_unsafe<false, true>(&string_out._str[string_out._size], arg.get_str(), arg.get_size() + 1);
       string_out._size = new_size;
     } else {
-      _Internal::from_type_grow(arg, &string_out._str, &string_out._size, &string_out._capacity);
+      _Internal::from_type_grow(arg, &string_out._str, &string_out._size, &string_out._capacity, string_out._allocator);
     }
   }
 
@@ -152,8 +171,9 @@ struct StringUnsafe
     constexpr u32 digit_count = sizeof(T) * 2;
     constexpr u32 new_size = digit_count + 2;
     if (new_size >= _capacity) {
+      u64 old_capacity = _capacity;
       _capacity = new_size * 1.5;
-      _str = (utf8*)realloc_unsafe(_str, _capacity);
+      _str = (utf8*)_allocator.reallocate(_str, old_capacity + 1, _capacity + 1);
     }
     _str[0] = u8'0';
     _str[1] = u8'x';
@@ -170,4 +190,4 @@ struct StringUnsafe
 }
 
 //---
-template <u64 RESERVE_CAPACITY> struct _is_unsafe_string<Pathlib::StringUnsafe<RESERVE_CAPACITY>> : true_type {};
\ No newline at end of file
+template <u64 RESERVE_CAPACITY, typename ALLOCATOR> struct _is_unsafe_string<Pathlib::StringUnsafe<RESERVE_CAPACITY, ALLOCATOR>> : true_type {};
\ No newline at end of file
@@ -0,0 +1,67 @@
+/*
+  Documentation: https://www.path.blog/docs/timer.html
+*/
+
+#pragma once
+#include "pathlib/types/types.h"
+#include "pathlib/memory/memory.h"
+
+namespace Pathlib {
+
+//---
+typedef void(*TimerCallback)(void* user_data);
+
+//---
+struct TimingWheel
+{
+  //---
+  static constexpr u32 LEVEL_COUNT = 4;
+  static constexpr u32 SLOT_BITS = 8;
+  static constexpr u32 SLOT_COUNT = (1 << SLOT_BITS);
+  static constexpr u32 SLOT_MASK = (SLOT_COUNT - 1);
+  static constexpr u32 RESERVE_CAPACITY = 1024;
+  static constexpr u32 NO_NODE = Types::U32_MAX;
+  static constexpr u64 INVALID_HANDLE = Types::U64_MAX;
+
+  //---
+  struct Node
+  {
+    u64 _deadline_ms;
+    TimerCallback _callback;
+    void* _user_data;
+    u32 _next;
+    u32 _previous;
+    u32 _generation;
+    u32 _slot;
+  };
+
+  //---
+  Node* _nodes;
+  u32 _node_capacity;
+  u32 _node_count;
+  u32 _free_head;
+  u32 _count;
+  u64 _current_ms;
+  u32 _slots[LEVEL_COUNT * SLOT_COUNT];
+
+  //---
+  DISALLOW_COPY(TimingWheel);
+  explicit TimingWheel(const MemoryName& name);
+  ~TimingWheel();
+
+  //---
+  u64 schedule(u64 delay_ms,
+               TimerCallback callback,
+               void* user_data);
+  bool cancel(u64 handle);
+  u32 advance();
+  u32 advance_to(u64 now_ms);
+  inline u32 get_count() const { return _count; }
+
+  //---
+  void link(u32 node_index);
+  void unlink(u32 node_index);
+  void release(u32 node_index);
+  void cascade(u32 level);
+};
+}
\ No newline at end of file
@@ -46,6 +46,7 @@ static constexpr u32 CACHE_LINE_SIZE = 64;
 
 //---
 #define EXPORT __declspec(dllexport)
+#define NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
 #define SAME_TYPE(A, B) __is_same(A, B)
 #define IS_VEC2(A) _is_vec2<A>::value
 #define IS_VEC3(A) _is_vec3<A>::value
@@ -58,6 +59,7 @@ static constexpr u32 CACHE_LINE_SIZE = 64;
 #define IS_UNSAFE_FIXED_STRING(A) _is_unsafe_fixed_string<A>::value
 #define IS_UNSAFE_STRING(A) _is_unsafe_string<A>::value
 #define IS_POINTER(A) _is_pointer<A>::value
+#define IS_TRIVIALLY_COPYABLE(A) __is_trivially_copyable(A)
 #define IS_REFERENCE(A) _is_reference<A>::value
 #define IS_ARRAY(A) _is_array<A>::value
 #define ARRAY_TYPE(A) _array_type<A>::value
@@ -27,11 +27,20 @@ namespace Pathlib::Win32 {
 
 //---
 static constexpr u32 MAX_PATH_LENGTH = 260;
+static constexpr u32 INFINITE_TIMEOUT = 0xFFFFFFFF;
 
 //---
 u32 get_current_thread_id();
 void yield_thread();
 void sleep_thread(u32 milliseconds);
+u32 get_processor_count();
+u32 get_current_processor();
+bool wait_on_address(volatile void* address,
+                     void* compare_address,
+                     u64 address_size,
+                     u32 timeout_ms);
+void wake_by_address_single(void* address);
+void wake_by_address_all(void* address);
 u64 get_callstack(utf8* string_out,
                   u64 string_capacity);
 u64 get_last_error_string(utf8* string_out,
@@ -103,6 +103,47 @@ inline T Atomic<T>::fetch_not_and(const T arg,
   return __atomic_nand_fetch(&_value, arg, mem_order);
 }
 
+//---
+Atomic128::Atomic128() {}
+
+//---
+Atomic128::Atomic128(const Value value)
+{
+  _value._low = value._low;
+  _value._high = value._high;
+}
+
+//---
+Atomic128::~Atomic128() {}
+
+//---
+void Atomic128::store(const Value value)
+{
+  Value expected = { _value._low, _value._high };
+  while (!compare_and_swap(expected, value)) {}
+}
+
+//---
+Atomic128::Value Atomic128::load()
+{
+  /* cmpxchg16b always writes, so a load is a compare-and-swap of zero with itself. */
+  Value expected = { 0, 0 };
+  (void)compare_and_swap(expected, expected);
+  return expected;
+}
+
+//---
+bool Atomic128::compare_and_swap(Value& expected_value,
+                                 const Value value_if_expected)
+{
+  bool swapped;
+  __asm__ __volatile__("lock cmpxchg16b %1"
+                       : "=@ccz"(swapped), "+m"(_value), "+a"(expected_value._low), "+d"(expected_value._high)
+                       : "b"(value_if_expected._low), "c"(value_if_expected._high)
+                       : "memory");
+  return swapped;
+}
+
 //---
 AtomicFlag::AtomicFlag() {}
 
@@ -0,0 +1,177 @@
+#include "pathlib/concurrency/epoch.h"
+#include "pathlib/memory/malloc_unsafe.h"
+#include "pathlib/errors/errors.h"
+#include "pathlib/win32/safe_win32.h"
+
+namespace Pathlib {
+
+//---
+_Internal::Epochs& get_epochs()
+{
+  static _Internal::Epochs epochs;
+  return epochs;
+}
+}
+
+namespace Pathlib::_Internal {
+
+//---
+static thread_local u32 current_participant = Epochs::NOT_REGISTERED;
+
+//---
+static void unregister_at_thread_exit()
+{
+  get_epochs().unregister_thread();
+}
+static thread_local ThreadExitHook thread_exit_hook = { nullptr };
+
+//---
+Epochs::Epochs()
+{
+  _global_epoch.store(0);
+}
+
+//---
+Epochs::~Epochs()
+{
+  u32 participant_count = _registry.get_count();
+  for (u32 p = 0; p < participant_count; ++p) {
+    Participant* participant = _registry._participants[p];
+    for (u32 r = 0; r < participant->_limbo_count; ++r) {
+      participant->_limbo[r]._function(participant->_limbo[r]._ptr);
+    }
+    free_unsafe((void**)&participant->_limbo);
+    free_unsafe((void**)&_registry._participants[p]);
+  }
+}
+
+//---
+Epochs::Participant& Epochs::get_participant()
+{
+  if (EXPECT(current_participant != NOT_REGISTERED)) {
+    return _registry[current_participant];
+  }
+  current_participant = _registry.claim([]()
+    {
+      Participant* participant = (Participant*)malloc_unsafe(sizeof(Participant), u8"Epochs::_participants");
+      participant->_local_epoch.store(0, MemOrder::RELAXED);
+      participant->_depth = 0;
+      participant->_retire_count = 0;
+      participant->_limbo_count = 0;
+      participant->_limbo_capacity = LIMBO_RESERVE_CAPACITY;
+      participant->_limbo = (Retired*)malloc_unsafe(sizeof(Retired) * LIMBO_RESERVE_CAPACITY, u8"Epochs::_limbo");
+      return participant;
+    }, u8"Epochs ran out of participant slots; more than MAX_PARTICIPANTS threads are registered at once.");
+  thread_exit_hook._function = unregister_at_thread_exit;
+  return _registry[current_participant];
+}
+
+//---
+void Epochs::enter()
+{
+  Participant& participant = get_participant();
+  if (participant._depth++ > 0) {
+    return;
+  }
+
+  /* Re-read until stable, so an advance that missed our store cannot leave us a stale epoch. */
+  u64 epoch = _global_epoch.load(MemOrder::RELAXED);
+  while (true) {
+    participant._local_epoch.store((epoch << 1) | ACTIVE, MemOrder::RELAXED);
+    atomic_fence(MemOrder::SEQ_CST);
+    u64 current = _global_epoch.load(MemOrder::RELAXED);
+    if (EXPECT(current == epoch)) {
+      return;
+    }
+    epoch = current;
+  }
+}
+
+//---
+void Epochs::exit()
+{
+  Participant& participant = _registry[current_participant];
+  if (--participant._depth == 0) {
+    participant._local_epoch.store(0, MemOrder::RELEASE);
+  }
+}
+
+//---
+void Epochs::retire(void* ptr,
+                    ReclaimFunction function)
+{
+  Participant& participant = get_participant();
+  if (participant._limbo_count == participant._limbo_capacity) {
+    reclaim(participant);
+    if (participant._limbo_count == participant._limbo_capacity) {
+      participant._limbo_capacity <<= 1;
+      participant._limbo = (Retired*)realloc_unsafe(participant._limbo, sizeof(Retired) * participant._limbo_capacity);
+    }
+  }
+  participant._limbo[participant._limbo_count++] = { ptr, function, _global_epoch.load(MemOrder::ACQUIRE) };
+  if ((++participant._retire_count & (RECLAIM_INTERVAL - 1)) == 0) {
+    (void)try_advance();
+    reclaim(participant);
+  }
+}
+
+//---
+bool Epochs::try_advance()
+{
+  u64 epoch = _global_epoch.load(MemOrder::ACQUIRE);
+  u32 participant_count = _registry.get_count();
+  atomic_fence(MemOrder::SEQ_CST);
+  for (u32 p = 0; p < participant_count; ++p) {
+    u64 local_epoch = _registry[p]._local_epoch.load(MemOrder::ACQUIRE);
+    if ((local_epoch & ACTIVE) && ((local_epoch >> 1) != epoch)) {
+      return false;
+    }
+  }
+  return (_global_epoch.compare_and_swap(epoch, epoch + 1, MemOrder::ACQ_REL) ||
+          (_global_epoch.load(MemOrder::ACQUIRE) != epoch));
+}
+
+//---
+void Epochs::reclaim(Participant& participant)
+{
+  /* Anything retired two epochs ago can no longer be referenced by an active reader. */
+  u64 epoch = _global_epoch.load(MemOrder::ACQUIRE);
+  u32 reclaimed = 0;
+  while ((reclaimed < participant._limbo_count) && ((participant._limbo[reclaimed]._epoch + 2) <= epoch)) {
+    participant._limbo[reclaimed]._function(participant._limbo[reclaimed]._ptr);
+    ++reclaimed;
+  }
+  if (reclaimed > 0) {
+    participant._limbo_count -= reclaimed;
+    for (u32 r = 0; r < participant._limbo_count; ++r) {
+      participant._limbo[r] = participant._limbo[r + reclaimed];
+    }
+  }
+}
+
+//---
+void Epochs::flush()
+{
+  Participant& participant = get_participant();
+  while (participant._limbo_count > 0) {
+    if (!try_advance()) {
+      Win32::yield_thread();
+    }
+    reclaim(participant);
+  }
+}
+
+//---
+void Epochs::unregister_thread()
+{
+  if (current_participant == NOT_REGISTERED) {
+    return;
+  }
+  Participant& participant = _registry[current_participant];
+  participant._depth = 0;
+  participant._local_epoch.store(0, MemOrder::RELEASE);
+  flush();
+  _registry.release(current_participant);
+  current_participant = NOT_REGISTERED;
+}
+}
\ No newline at end of file
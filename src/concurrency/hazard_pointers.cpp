@@ -0,0 +1,168 @@
+#include "pathlib/concurrency/hazard_pointers.h"
+#include "pathlib/math/math.h"
+#include "pathlib/memory/malloc_unsafe.h"
+#include "pathlib/errors/errors.h"
+#include "pathlib/win32/safe_win32.h"
+
+namespace Pathlib {
+
+//---
+_Internal::HazardPointers& get_hazard_pointers()
+{
+  static _Internal::HazardPointers hazard_pointers;
+  return hazard_pointers;
+}
+}
+
+namespace Pathlib::_Internal {
+
+//---
+static thread_local u32 current_participant = HazardPointers::NOT_REGISTERED;
+
+//---
+static void unregister_at_thread_exit()
+{
+  get_hazard_pointers().unregister_thread();
+}
+static thread_local ThreadExitHook thread_exit_hook = { nullptr };
+
+//---
+HazardPointers::HazardPointers()
+{
+}
+
+//---
+HazardPointers::~HazardPointers()
+{
+  u32 participant_count = _registry.get_count();
+  for (u32 p = 0; p < participant_count; ++p) {
+    Participant* participant = _registry._participants[p];
+    for (u32 r = 0; r < participant->_retired_count; ++r) {
+      participant->_retired[r]._function(participant->_retired[r]._ptr);
+    }
+    free_unsafe((void**)&participant->_retired);
+    free_unsafe((void**)&_registry._participants[p]);
+  }
+}
+
+//---
+HazardPointers::Participant& HazardPointers::get_participant()
+{
+  if (EXPECT(current_participant != NOT_REGISTERED)) {
+    return _registry[current_participant];
+  }
+  current_participant = _registry.claim([]()
+    {
+      Participant* participant = (Participant*)malloc_unsafe(sizeof(Participant), u8"HazardPointers::_participants");
+      for (u32 h = 0; h < HAZARDS_PER_THREAD; ++h) {
+        participant->_hazards[h].store(0, MemOrder::RELAXED);
+      }
+      participant->_retired_count = 0;
+      participant->_retired_capacity = RETIRED_RESERVE_CAPACITY;
+      participant->_retired = (Retired*)malloc_unsafe(sizeof(Retired) * RETIRED_RESERVE_CAPACITY, u8"HazardPointers::_retired");
+      return participant;
+    }, u8"HazardPointers ran out of participant slots; more than MAX_PARTICIPANTS threads are registered at once.");
+  thread_exit_hook._function = unregister_at_thread_exit;
+  return _registry[current_participant];
+}
+
+//---
+void* HazardPointers::protect(u32 hazard_index,
+                              Atomic<u64>& source)
+{
+  Participant& participant = get_participant();
+  u64 ptr = source.load(MemOrder::RELAXED);
+  while (true) {
+    participant._hazards[hazard_index].store(ptr, MemOrder::RELAXED);
+    atomic_fence(MemOrder::SEQ_CST);
+    u64 current = source.load(MemOrder::ACQUIRE);
+    if (EXPECT(current == ptr)) {
+      return (void*)ptr;
+    }
+    ptr = current;
+  }
+}
+
+//---
+void HazardPointers::clear(u32 hazard_index)
+{
+  _registry[current_participant]._hazards[hazard_index].store(0, MemOrder::RELEASE);
+}
+
+//---
+void HazardPointers::retire(void* ptr,
+                            ReclaimFunction function)
+{
+  Participant& participant = get_participant();
+  if (participant._retired_count == participant._retired_capacity) {
+    participant._retired_capacity <<= 1;
+    participant._retired = (Retired*)realloc_unsafe(participant._retired, sizeof(Retired) * participant._retired_capacity);
+  }
+  participant._retired[participant._retired_count++] = { ptr, function, 0 };
+
+  /* Scanning costs every published hazard; amortize it over a multiple of that count. */
+  u32 scan_threshold = Math::max(RETIRED_RESERVE_CAPACITY >> 1,
+                                 _registry._count.load(MemOrder::RELAXED) * HAZARDS_PER_THREAD * 2);
+  if (participant._retired_count >= scan_threshold) {
+    scan(participant);
+  }
+}
+
+//---
+bool HazardPointers::is_hazardous(void* ptr)
+{
+  u32 participant_count = _registry.get_count();
+  for (u32 p = 0; p < participant_count; ++p) {
+    Participant* participant = _registry._participants[p];
+    for (u32 h = 0; h < HAZARDS_PER_THREAD; ++h) {
+      if (participant->_hazards[h].load(MemOrder::ACQUIRE) == (u64)ptr) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+//---
+void HazardPointers::scan(Participant& participant)
+{
+  atomic_fence(MemOrder::SEQ_CST);
+  u32 kept = 0;
+  for (u32 r = 0; r < participant._retired_count; ++r) {
+    if (is_hazardous(participant._retired[r]._ptr)) {
+      participant._retired[kept++] = participant._retired[r];
+    } else {
+      participant._retired[r]._function(participant._retired[r]._ptr);
+    }
+  }
+  participant._retired_count = kept;
+}
+
+//---
+void HazardPointers::flush()
+{
+  Participant& participant = get_participant();
+  while (true) {
+    scan(participant);
+    if (participant._retired_count == 0) {
+      return;
+    }
+    Win32::yield_thread();
+  }
+}
+
+//---
+void HazardPointers::unregister_thread()
+{
+  if (current_participant == NOT_REGISTERED) {
+    return;
+  }
+  Participant& participant = _registry[current_participant];
+  for (u32 h = 0; h < HAZARDS_PER_THREAD; ++h) {
+    participant._hazards[h].store(0, MemOrder::RELEASE);
+  }
+  flush();
+  _registry.release(current_participant);
+  current_participant = NOT_REGISTERED;
+}
+}
\ No newline at end of file
@@ -0,0 +1,202 @@
+#include "pathlib/concurrency/task.h"
+#include "pathlib/math/math.h"
+#include "pathlib/memory/malloc_unsafe.h"
+#include "pathlib/win32/safe_win32.h"
+
+namespace Pathlib {
+
+//---
+_Internal::CoroutineFrames& get_coroutine_frames()
+{
+  static _Internal::CoroutineFrames coroutine_frames;
+  return coroutine_frames;
+}
+
+//---
+_Internal::Sleepers& get_sleepers()
+{
+  static _Internal::Sleepers sleepers;
+  return sleepers;
+}
+
+//---
+void SleepFor::await_suspend(std::coroutine_handle<> handle) const
+{
+  get_sleepers().push(_deadline_ms, handle.address());
+}
+}
+
+namespace Pathlib::_Internal {
+
+//---
+void resume_coroutine(void* frame)
+{
+  std::coroutine_handle<>::from_address(frame).resume();
+}
+
+//---
+void* TaskPromiseBase::operator new(u64 size)
+{
+  return get_coroutine_frames().allocate(size);
+}
+
+//---
+void TaskPromiseBase::operator delete(void* frame,
+                                      u64 size)
+{
+  get_coroutine_frames().free(frame, size);
+}
+
+//---
+static inline u32 frame_size_class(u64 size)
+{
+  return (u32)Math::log2(Math::round_up_to_pot(Math::max(size, CoroutineFrames::MIN_FRAME_SIZE)) / CoroutineFrames::MIN_FRAME_SIZE);
+}
+
+//---
+CoroutineFrames::CoroutineFrames()
+{
+  _arena.allocate(ARENA_CAPACITY);
+}
+
+//---
+CoroutineFrames::~CoroutineFrames()
+{
+  _arena.free();
+}
+
+//---
+void* CoroutineFrames::allocate(u64 size)
+{
+  /* Frames are recycled per power-of-two size class; the arena only grows when a class runs dry. */
+  u32 size_class = frame_size_class(size);
+  if (EXPECT(size_class < SIZE_CLASS_COUNT)) {
+    FreeFrame* frame = _free_frames[size_class].pop();
+    if (frame) {
+      return frame;
+    }
+    frame = (FreeFrame*)_arena.try_push(MIN_FRAME_SIZE << size_class);
+    if (frame) {
+      return frame;
+    }
+  }
+  return malloc_unsafe(size, u8"Coroutine frame");
+}
+
+//---
+void CoroutineFrames::free(void* frame,
+                           u64 size)
+{
+  if (((u8*)frame >= _arena._head) && ((u8*)frame < (_arena._head + _arena._capacity))) {
+    _free_frames[frame_size_class(size)].push((FreeFrame*)frame);
+  } else {
+    free_unsafe(&frame);
+  }
+}
+
+//---
+static ulong sleepers_main(void* user_data)
+{
+  Sleepers* sleepers = (Sleepers*)user_data;
+  while (sleepers->_running.load(MemOrder::ACQUIRE)) {
+    u32 wake_epoch = sleepers->_wake_epoch.load(MemOrder::ACQUIRE);
+    u64 now_ms = get_timer().now_ms();
+    u64 next_deadline_ms = sleepers->resume_expired(now_ms);
+    u32 timeout_ms = (next_deadline_ms == Types::U64_MAX) ? Win32::INFINITE_TIMEOUT :
+                                                           (u32)Math::min(next_deadline_ms - now_ms, (u64)Types::U32_MAX - 1);
+    Win32::wait_on_address(&sleepers->_wake_epoch._value, &wake_epoch, sizeof(u32), timeout_ms);
+  }
+  return 0;
+}
+
+//---
+Sleepers::Sleepers()
+{
+  _count = 0;
+  _capacity = RESERVE_CAPACITY;
+  _heap = (Sleeper*)malloc_unsafe(sizeof(Sleeper) * _capacity, u8"Sleepers::_heap");
+  _wake_epoch.store(0);
+  _running.store(1);
+  if (!_thread.spawn(this, sleepers_main)) {
+    get_errors().fatal(u8"Failed to spawn the coroutine sleeper thread.");
+  }
+}
+
+//---
+Sleepers::~Sleepers()
+{
+  _running.store(0, MemOrder::RELEASE);
+  _wake_epoch.fetch_add(1, MemOrder::RELEASE);
+  Win32::wake_by_address_single((void*)&_wake_epoch._value);
+  _thread.join();
+  free_unsafe((void**)&_heap);
+}
+
+//---
+void Sleepers::push(u64 deadline_ms,
+                    void* frame)
+{
+  _lock.acquire();
+  if (_count == _capacity) {
+    _capacity <<= 1;
+    _heap = (Sleeper*)realloc_unsafe(_heap, sizeof(Sleeper) * _capacity);
+  }
+  u32 index = _count++;
+  while (index > 0) {
+    u32 parent = (index - 1) >> 1;
+    if (_heap[parent]._deadline_ms <= deadline_ms) {
+      break;
+    }
+    _heap[index] = _heap[parent];
+    index = parent;
+  }
+  _heap[index] = { deadline_ms, frame };
+  _lock.release();
+
+  /* Only a new earliest deadline changes how long the sleeper thread should wait. */
+  if (index == 0) {
+    _wake_epoch.fetch_add(1, MemOrder::RELEASE);
+    Win32::wake_by_address_single((void*)&_wake_epoch._value);
+  }
+}
+
+//---
+u64 Sleepers::resume_expired(u64 now_ms)
+{
+  /* Frames are submitted after the lock is released; a full pool runs them inline, and a resumed
+     coroutine that sleeps again would otherwise re-enter push() while we still hold the lock. */
+  void* frames[RESUME_BATCH];
+  u32 frame_count;
+  u64 next_deadline_ms;
+  do {
+    frame_count = 0;
+    _lock.acquire();
+    while ((frame_count < RESUME_BATCH) && (_count > 0) && (_heap[0]._deadline_ms <= now_ms)) {
+      frames[frame_count++] = _heap[0]._frame;
+      Sleeper last = _heap[--_count];
+      u32 index = 0;
+      while (true) {
+        u32 child = (index << 1) + 1;
+        if (child >= _count) {
+          break;
+        }
+        if (((child + 1) < _count) && (_heap[child + 1]._deadline_ms < _heap[child]._deadline_ms)) {
+          ++child;
+        }
+        if (last._deadline_ms <= _heap[child]._deadline_ms) {
+          break;
+        }
+        _heap[index] = _heap[child];
+        index = child;
+      }
+      _heap[index] = last;
+    }
+    next_deadline_ms = (_count > 0) ? _heap[0]._deadline_ms : Types::U64_MAX;
+    _lock.release();
+    for (u32 f = 0; f < frame_count; ++f) {
+      get_threadpool().submit(resume_coroutine, frames[f]);
+    }
+  } while (frame_count == RESUME_BATCH);
+  return next_deadline_ms;
+}
+}
\ No newline at end of file
@@ -7,13 +7,64 @@ namespace Pathlib {
 
 //---
 bool Thread::spawn(void* user_data,
-                   ulong(*thread_function)(void* user_data))
+                   ulong(*thread_function)(void* user_data),
+                   const ThreadOptions& options)
 {
-  _thread = CreateThread(nullptr, 0, (DWORD(*)(void*))thread_function, user_data, 0, nullptr);
+  DWORD flags = CREATE_SUSPENDED;
+  if (options._stack_size != ThreadOptions::DEFAULT_STACK_SIZE) {
+    flags |= STACK_SIZE_PARAM_IS_A_RESERVATION;
+  }
+  _thread = CreateThread(nullptr, options._stack_size, (DWORD(*)(void*))thread_function, user_data, flags, nullptr);
   if (!_thread) {
     get_errors().to_log_with_stacktrace(u8"Failed to spawn thread.");
     return false;
   }
+
+  /* Placement is applied while suspended, so the thread never runs on the wrong node; if it fails, the thread never runs at all. */
+  bool placed = true;
+  if (options._numa_node != ThreadOptions::ANY_NUMA_NODE) {
+    placed = set_numa_node(options._numa_node);
+  } else if (options._affinity_mask != ThreadOptions::ANY_PROCESSOR) {
+    placed = set_affinity(options._affinity_mask, options._processor_group);
+  }
+  if (!placed) {
+    terminate();
+    return false;
+  }
+  if (ResumeThread(_thread) == (DWORD)-1) {
+    get_errors().to_log_with_stacktrace(u8"Failed to resume spawned thread.");
+    terminate();
+    return false;
+  }
+  return true;
+}
+
+//---
+bool Thread::set_affinity(u64 affinity_mask,
+                          u16 processor_group)
+{
+  GROUP_AFFINITY affinity = {};
+  affinity.Mask = affinity_mask;
+  affinity.Group = processor_group;
+  if (!SetThreadGroupAffinity(_thread, &affinity, nullptr)) {
+    get_errors().to_log_with_stacktrace(u8"Failed to set thread affinity.");
+    return false;
+  }
+  return true;
+}
+
+//---
+bool Thread::set_numa_node(u32 numa_node)
+{
+  GROUP_AFFINITY affinity = {};
+  if (!GetNumaNodeProcessorMaskEx((USHORT)numa_node, &affinity) || (affinity.Mask == 0)) {
+    get_errors().to_log_with_stacktrace(u8"Failed to query processors of NUMA node ", numa_node, u8".");
+    return false;
+  }
+  if (!SetThreadGroupAffinity(_thread, &affinity, nullptr)) {
+    get_errors().to_log_with_stacktrace(u8"Failed to bind thread to NUMA node ", numa_node, u8".");
+    return false;
+  }
   return true;
 }
 
@@ -0,0 +1,302 @@
+#include "pathlib/concurrency/threadpool.h"
+#include "pathlib/concurrency/epoch.h"
+#include "pathlib/concurrency/hazard_pointers.h"
+#include "pathlib/math/math.h"
+#include "pathlib/memory/malloc_unsafe.h"
+#include "pathlib/memory/memset_unsafe.h"
+#include "pathlib/memory/slabs.h"
+#include "pathlib/errors/errors.h"
+#include "pathlib/log/log.h"
+#include "../src/win32/mindows.h"
+
+namespace Pathlib {
+
+//---
+static ThreadpoolOptions threadpool_options;
+static bool threadpool_created = false;
+
+//---
+_Internal::Threadpool& get_threadpool()
+{
+  static _Internal::Threadpool threadpool;
+  return threadpool;
+}
+
+//---
+bool set_threadpool_options(const ThreadpoolOptions& options)
+{
+  if (threadpool_created) {
+    get_errors().to_log_with_stacktrace(u8"Threadpool options must be set before the threadpool is first used.");
+    return false;
+  }
+  threadpool_options = options;
+  return true;
+}
+}
+
+namespace Pathlib::_Internal {
+
+//---
+static thread_local u32 current_worker_index = Threadpool::NOT_A_WORKER;
+
+//---
+static inline u32 next_random(u32& state)
+{
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state;
+}
+
+//---
+static ulong worker_main(void* user_data)
+{
+  Threadpool::Worker* worker = (Threadpool::Worker*)user_data;
+  Threadpool* pool = worker->_pool;
+  current_worker_index = worker->_index;
+  u32 spins = 0;
+  while (pool->_running.load(MemOrder::ACQUIRE)) {
+    Job job;
+    if (pool->find_job(worker->_index, worker->_random_state, job)) {
+      pool->execute(job);
+      spins = 0;
+    } else if (++spins < Threadpool::SPINS_BEFORE_PARKING) {
+      __builtin_ia32_pause();
+    } else {
+      pool->park();
+      spins = 0;
+    }
+  }
+  get_epochs().unregister_thread();
+  get_hazard_pointers().unregister_thread();
+  get_memory().release_scratch_arena();
+  get_slabs().release_thread_cache();
+  return 0;
+}
+
+//---
+static u32 get_pinnable_processors(GROUP_AFFINITY* processors_out,
+                                   u32 capacity)
+{
+  /* A process confined to one group reports its mask there; one spanning groups reports 0 and may use every active processor. */
+  u32 count = 0;
+  DWORD_PTR process_mask = 0;
+  DWORD_PTR system_mask = 0;
+  GROUP_AFFINITY current = {};
+  if (GetProcessAffinityMask(GetCurrentProcess(), &process_mask, &system_mask) && (process_mask != 0) &&
+      GetThreadGroupAffinity(GetCurrentThread(), &current)) {
+    for (u32 p = 0; (p < 64) && (count < capacity); ++p) {
+      if (process_mask & (1ULL << p)) {
+        processors_out[count] = {};
+        processors_out[count].Mask = (1ULL << p);
+        processors_out[count].Group = current.Group;
+        ++count;
+      }
+    }
+    return count;
+  }
+  WORD group_count = GetActiveProcessorGroupCount();
+  for (WORD g = 0; g < group_count; ++g) {
+    DWORD group_processors = Math::min(GetActiveProcessorCount(g), 64UL);
+    for (u32 p = 0; (p < group_processors) && (count < capacity); ++p) {
+      processors_out[count] = {};
+      processors_out[count].Mask = (1ULL << p);
+      processors_out[count].Group = g;
+      ++count;
+    }
+  }
+  return count;
+}
+
+//---
+Threadpool::Threadpool()
+{
+  /* Workers touch these singletons on their way out; constructing them first makes them outlive the pool,
+     since function-local statics are destroyed in reverse order of construction. */
+  (void)get_epochs();
+  (void)get_hazard_pointers();
+  (void)get_memory();
+  (void)get_slabs();
+
+  _shared_lock.clear();
+  _wake_epoch.store(0);
+  _sleeping_count.store(0);
+  _running.store(1);
+  u32 processor_count = Win32::get_processor_count();
+  _worker_count = Math::min(Math::max(processor_count, 2U) - 1, MAX_THREAD_COUNT - 1);
+  _workers = (Worker*)malloc_unsafe(sizeof(Worker) * (_worker_count + 1), u8"Threadpool::_workers");
+  memset_unsafe(_workers, 0, sizeof(Worker) * (_worker_count + 1));
+  for (u32 w = 0; w <= _worker_count; ++w) {
+    Worker& worker = _workers[w];
+    worker._jobs.clear();
+    worker._thread._thread = nullptr;
+    worker._pool = this;
+    worker._index = w;
+    worker._random_state = Math::hash(w) | 1;
+  }
+
+  /* Slot 0 belongs to the thread that created the pool; it only runs jobs while inside wait(). */
+  current_worker_index = 0;
+  threadpool_created = true;
+  GROUP_AFFINITY processors[MAX_THREAD_COUNT];
+  u32 processor_slots = threadpool_options._pin_workers ? get_pinnable_processors(processors, MAX_THREAD_COUNT) : 0;
+  for (u32 w = 1; w <= _worker_count; ++w) {
+    ThreadOptions options;
+    if (processor_slots > 0) {
+      const GROUP_AFFINITY& processor = processors[w % processor_slots];
+      options._affinity_mask = processor.Mask;
+      options._processor_group = processor.Group;
+    }
+    if (!_workers[w]._thread.spawn(&_workers[w], worker_main, options) &&
+        ((processor_slots == 0) || !_workers[w]._thread.spawn(&_workers[w], worker_main))) {
+      get_errors().to_log_with_stacktrace(u8"Threadpool failed to spawn worker ", w, u8".");
+      _worker_count = w - 1;
+      break;
+    }
+  }
+  get_log().logt(u8"Threadpool created with ", _worker_count, u8" worker threads.");
+}
+
+//---
+Threadpool::~Threadpool()
+{
+  _running.store(0, MemOrder::RELEASE);
+  _wake_epoch.fetch_add(1, MemOrder::RELEASE);
+  Win32::wake_by_address_all((void*)&_wake_epoch._value);
+  for (u32 w = 1; w <= _worker_count; ++w) {
+    _workers[w]._thread.join();
+  }
+  free_unsafe((void**)&_workers);
+}
+
+//---
+bool Threadpool::submit(JobFunction function,
+                        void* user_data,
+                        JobCounter* counter)
+{
+  Job job = { function, user_data, counter };
+  if (counter) {
+    counter->_pending.fetch_add(1, MemOrder::RELAXED);
+  }
+  bool pushed;
+  u32 worker_index = current_worker_index;
+  if (worker_index != NOT_A_WORKER) {
+    pushed = _workers[worker_index]._jobs.push(job);
+  } else {
+    while (_shared_lock.test_and_set(MemOrder::ACQUIRE)) {
+      __builtin_ia32_pause();
+    }
+    pushed = _shared_jobs.push(job);
+    _shared_lock.clear(MemOrder::RELEASE);
+  }
+  if (DONT_EXPECT(!pushed)) {
+    /* The job still completes, just on the submitting thread. */
+    execute(job);
+    return true;
+  }
+  wake_one();
+  return true;
+}
+
+//---
+void Threadpool::wait(JobCounter& counter)
+{
+  u32 worker_index = current_worker_index;
+  u32 random_state = Math::hash(Win32::get_current_thread_id()) | 1;
+  u32 spins = 0;
+  while (!counter.is_done()) {
+    Job job;
+    if (find_job(worker_index, random_state, job)) {
+      execute(job);
+      spins = 0;
+    } else if (++spins < SPINS_BEFORE_PARKING) {
+      __builtin_ia32_pause();
+    } else {
+      u32 pending = counter._pending.load(MemOrder::ACQUIRE);
+      if (pending != 0) {
+        Win32::wait_on_address(&counter._pending._value, &pending, sizeof(u32), Thread::INFINITE_TIMEOUT);
+      }
+      spins = 0;
+    }
+  }
+}
+
+//---
+u32 Threadpool::get_thread_count() const
+{
+  return (_worker_count + 1);
+}
+
+//---
+u32 Threadpool::get_current_worker_index() const
+{
+  return current_worker_index;
+}
+
+//---
+bool Threadpool::find_job(u32 worker_index,
+                          u32& random_state,
+                          Job& job_out)
+{
+  if ((worker_index != NOT_A_WORKER) && _workers[worker_index]._jobs.pop(job_out)) {
+    return true;
+  }
+  if (_shared_jobs.steal(job_out)) {
+    return true;
+  }
+  u32 deque_count = _worker_count + 1;
+  u32 victim = next_random(random_state) % deque_count;
+  for (u32 v = 0; v < deque_count; ++v) {
+    if ((victim != worker_index) && _workers[victim]._jobs.steal(job_out)) {
+      return true;
+    }
+    victim = (victim + 1 == deque_count) ? 0 : (victim + 1);
+  }
+  return false;
+}
+
+//---
+void Threadpool::execute(const Job& job)
+{
+  job._function(job._user_data);
+  if (job._counter && (job._counter->_pending.fetch_sub(1, MemOrder::RELEASE) == 0)) {
+    /* The waiter may return and free the counter as soon as it reads zero, so only its address is used here. */
+    Win32::wake_by_address_all((void*)&job._counter->_pending._value);
+  }
+}
+
+//---
+bool Threadpool::has_work()
+{
+  if (!_shared_jobs.is_empty()) {
+    return true;
+  }
+  for (u32 w = 0; w <= _worker_count; ++w) {
+    if (!_workers[w]._jobs.is_empty()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+//---
+void Threadpool::wake_one()
+{
+  atomic_fence(MemOrder::SEQ_CST);
+  if (_sleeping_count.load(MemOrder::RELAXED) > 0) {
+    _wake_epoch.fetch_add(1, MemOrder::RELEASE);
+    Win32::wake_by_address_single((void*)&_wake_epoch._value);
+  }
+}
+
+//---
+void Threadpool::park()
+{
+  u32 epoch = _wake_epoch.load(MemOrder::ACQUIRE);
+  _sleeping_count.fetch_add(1, MemOrder::SEQ_CST);
+  if (!has_work() && _running.load(MemOrder::ACQUIRE)) {
+    Win32::wait_on_address(&_wake_epoch._value, &epoch, sizeof(u32), Thread::INFINITE_TIMEOUT);
+  }
+  _sleeping_count.fetch_sub(1, MemOrder::RELAXED);
+}
+}
\ No newline at end of file
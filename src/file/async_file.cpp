@@ -0,0 +1,245 @@
+#include "pathlib/file/async_file.h"
+#include "pathlib/concurrency/task.h"
+#include "pathlib/errors/errors.h"
+#include "pathlib/log/log.h"
+#include "../src/win32/mindows.h"
+
+#pragma comment(lib, "ntdll.lib")
+
+namespace Pathlib {
+
+//---
+static_assert(sizeof(OVERLAPPED) == FileRequest::OVERLAPPED_SIZE, "FileRequest::_overlapped must match OVERLAPPED.");
+
+//---
+_Internal::AsyncIO& get_async_io()
+{
+  static _Internal::AsyncIO async_io;
+  return async_io;
+}
+
+//---
+AsyncFile::AsyncFile()
+{
+  _handle = nullptr;
+  _size = 0;
+}
+
+//---
+AsyncFile::~AsyncFile()
+{
+  close();
+}
+
+//---
+bool AsyncFile::open(const utf8* path,
+                     u32 mode)
+{
+  close();
+  wchar_t utf16_path[Win32::MAX_PATH_LENGTH];
+  if (Win32::utf8_to_utf16(utf16_path, Win32::MAX_PATH_LENGTH, path) == 0) {
+    get_errors().to_log_with_stacktrace(u8"Failed to convert file path: ", path);
+    return false;
+  }
+  DWORD access = ((mode & READ) ? GENERIC_READ : 0) | ((mode & WRITE) ? GENERIC_WRITE : 0);
+  DWORD disposition = (mode & WRITE) ? OPEN_ALWAYS : OPEN_EXISTING;
+  _handle = CreateFileW(utf16_path, access, FILE_SHARE_READ, nullptr, disposition,
+                        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_OVERLAPPED, nullptr);
+  if ((_handle == INVALID_HANDLE_VALUE) || (_handle == nullptr)) {
+    _handle = nullptr;
+    utf8 win_err[128];
+    get_errors().last_error_from_win32(win_err, 128);
+    get_errors().to_log_with_stacktrace(u8"Failed to open file \"", path, u8"\": ", win_err);
+    return false;
+  }
+  LARGE_INTEGER size;
+  _size = GetFileSizeEx(_handle, &size) ? size.QuadPart : 0;
+  if (!get_async_io().attach(_handle)) {
+    close();
+    return false;
+  }
+  return true;
+}
+
+//---
+void AsyncFile::close()
+{
+  if (_handle) {
+    CloseHandle(_handle);
+    _handle = nullptr;
+    _size = 0;
+  }
+}
+
+//---
+bool AsyncFile::read(FileRequest& request,
+                     u64 offset,
+                     void* buffer,
+                     u32 size,
+                     FileCallback callback,
+                     void* user_data)
+{
+  request._buffer = buffer;
+  request._offset = offset;
+  request._size = size;
+  request._callback = callback;
+  request._user_data = user_data;
+  request._coroutine = nullptr;
+  return submit(request, false);
+}
+
+//---
+bool AsyncFile::write(FileRequest& request,
+                      u64 offset,
+                      const void* buffer,
+                      u32 size,
+                      FileCallback callback,
+                      void* user_data)
+{
+  request._buffer = (void*)buffer;
+  request._offset = offset;
+  request._size = size;
+  request._callback = callback;
+  request._user_data = user_data;
+  request._coroutine = nullptr;
+  return submit(request, true);
+}
+
+//---
+AsyncFile::Awaiter AsyncFile::read_async(u64 offset,
+                                         void* buffer,
+                                         u32 size)
+{
+  Awaiter awaiter = { this, {}, false };
+  awaiter._request._buffer = buffer;
+  awaiter._request._offset = offset;
+  awaiter._request._size = size;
+  return awaiter;
+}
+
+//---
+AsyncFile::Awaiter AsyncFile::write_async(u64 offset,
+                                          const void* buffer,
+                                          u32 size)
+{
+  Awaiter awaiter = { this, {}, true };
+  awaiter._request._buffer = (void*)buffer;
+  awaiter._request._offset = offset;
+  awaiter._request._size = size;
+  return awaiter;
+}
+
+//---
+bool AsyncFile::Awaiter::await_suspend(std::coroutine_handle<> handle)
+{
+  _request._callback = nullptr;
+  _request._coroutine = handle.address();
+
+  /* A request that fails to start never completes on the port; resume immediately instead. */
+  return _file->submit(_request, _is_write);
+}
+
+//---
+bool AsyncFile::submit(FileRequest& request,
+                       bool is_write)
+{
+  OVERLAPPED* overlapped = (OVERLAPPED*)request._overlapped;
+  overlapped->Internal = 0;
+  overlapped->InternalHigh = 0;
+  overlapped->Offset = (DWORD)request._offset;
+  overlapped->OffsetHigh = (DWORD)(request._offset >> 32);
+  overlapped->hEvent = nullptr;
+  request._bytes_transferred = 0;
+  request._error = 0;
+  get_async_io()._in_flight.fetch_add(1, MemOrder::RELAXED);
+  BOOL started = is_write ? WriteFile(_handle, (const HANDLE)request._buffer, request._size, nullptr, overlapped) :
+                            ReadFile(_handle, request._buffer, request._size, nullptr, overlapped);
+  if (!started && (GetLastError() != ERROR_IO_PENDING)) {
+    get_async_io()._in_flight.fetch_sub(1, MemOrder::RELAXED);
+    request._error = GetLastError();
+    return false;
+  }
+  return true;
+}
+}
+
+namespace Pathlib::_Internal {
+
+//---
+static ulong completion_main(void* user_data)
+{
+  AsyncIO* async_io = (AsyncIO*)user_data;
+  OVERLAPPED_ENTRY entries[AsyncIO::COMPLETION_BATCH];
+  while (true) {
+    ULONG count = 0;
+    if (!GetQueuedCompletionStatusEx(async_io->_port, entries, AsyncIO::COMPLETION_BATCH, &count, INFINITE, FALSE)) {
+      continue;
+    }
+    for (u32 c = 0; c < count; ++c) {
+      if (entries[c].lpCompletionKey == AsyncIO::SHUTDOWN_KEY) {
+        return 0;
+      }
+      FileRequest* request = (FileRequest*)entries[c].lpOverlapped;
+      request->_bytes_transferred = entries[c].dwNumberOfBytesTransferred;
+      /* Internal holds an NTSTATUS; convert it so _error is a Win32 error code on every path, like the one submit stores. */
+      request->_error = (u32)RtlNtStatusToDosError((LONG)entries[c].Internal);
+      async_io->complete(*request);
+    }
+  }
+}
+
+//---
+AsyncIO::AsyncIO()
+{
+  _in_flight.store(0);
+  _port = CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, 1);
+  if (!_port) {
+    utf8 win_err[128];
+    get_errors().last_error_from_win32(win_err, 128);
+    get_errors().fatal(FixedStringUnsafe<256>(u8"Failed to create I/O completion port: ", win_err)._str);
+    return;
+  }
+  if (!_thread.spawn(this, completion_main)) {
+    get_errors().fatal(u8"Failed to spawn the I/O completion thread.");
+    return;
+  }
+  get_log().logt(u8"Async I/O started on a completion port.");
+}
+
+//---
+AsyncIO::~AsyncIO()
+{
+  while (_in_flight.load(MemOrder::ACQUIRE) > 0) {
+    Win32::yield_thread();
+  }
+  PostQueuedCompletionStatus(_port, 0, SHUTDOWN_KEY, nullptr);
+  _thread.join();
+  CloseHandle(_port);
+}
+
+//---
+bool AsyncIO::attach(HANDLE file)
+{
+  if (CreateIoCompletionPort(file, _port, 0, 0) != _port) {
+    utf8 win_err[128];
+    get_errors().last_error_from_win32(win_err, 128);
+    get_errors().to_log_with_stacktrace(u8"Failed to attach file to completion port: ", win_err);
+    return false;
+  }
+  return true;
+}
+
+//---
+void AsyncIO::complete(FileRequest& request)
+{
+  /* Callbacks run on the completion thread and should only hand off; coroutines resume on the pool. */
+  FileCallback callback = request._callback;
+  void* coroutine = request._coroutine;
+  _in_flight.fetch_sub(1, MemOrder::RELEASE);
+  if (callback) {
+    callback(request);
+  } else if (coroutine) {
+    get_threadpool().submit(resume_coroutine, coroutine);
+  }
+}
+}
\ No newline at end of file
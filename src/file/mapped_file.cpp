@@ -0,0 +1,119 @@
+#include "pathlib/file/mapped_file.h"
+#include "pathlib/math/math.h"
+#include "pathlib/errors/errors.h"
+#include "../src/win32/mindows.h"
+
+namespace Pathlib {
+
+//---
+MappedFile::MappedFile()
+{
+  _file = nullptr;
+  _mapping = nullptr;
+  _view = nullptr;
+  _size = 0;
+  _copy_on_write = false;
+}
+
+//---
+MappedFile::~MappedFile()
+{
+  close();
+}
+
+//---
+bool MappedFile::open(const utf8* path,
+                      u32 flags)
+{
+  close();
+  wchar_t utf16_path[Win32::MAX_PATH_LENGTH];
+  if (Win32::utf8_to_utf16(utf16_path, Win32::MAX_PATH_LENGTH, path) == 0) {
+    get_errors().to_log_with_stacktrace(u8"Failed to convert file path: ", path);
+    return false;
+  }
+
+  /* Access hints steer the cache manager's read-ahead, which is what backs page faults on the view. */
+  DWORD attributes = FILE_ATTRIBUTE_NORMAL;
+  if (flags & ACCESS_SEQUENTIAL) {
+    attributes |= FILE_FLAG_SEQUENTIAL_SCAN;
+  } else if (flags & ACCESS_RANDOM) {
+    attributes |= FILE_FLAG_RANDOM_ACCESS;
+  }
+  _file = CreateFileW(utf16_path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, attributes, nullptr);
+  if ((_file == INVALID_HANDLE_VALUE) || (_file == nullptr)) {
+    _file = nullptr;
+    utf8 win_err[128];
+    get_errors().last_error_from_win32(win_err, 128);
+    get_errors().to_log_with_stacktrace(u8"Failed to open file \"", path, u8"\" for mapping: ", win_err);
+    return false;
+  }
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(_file, &size)) {
+    utf8 win_err[128];
+    get_errors().last_error_from_win32(win_err, 128);
+    get_errors().to_log_with_stacktrace(u8"Failed to get size of \"", path, u8"\": ", win_err);
+    close();
+    return false;
+  }
+  _size = size.QuadPart;
+  _copy_on_write = (flags & COPY_ON_WRITE);
+  if (_size == 0) {
+    return true;
+  }
+  _mapping = CreateFileMappingW(_file, nullptr, _copy_on_write ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0, nullptr);
+  if (!_mapping) {
+    utf8 win_err[128];
+    get_errors().last_error_from_win32(win_err, 128);
+    get_errors().to_log_with_stacktrace(u8"Failed to create mapping of \"", path, u8"\": ", win_err);
+    close();
+    return false;
+  }
+  _view = (u8*)MapViewOfFile(_mapping, _copy_on_write ? FILE_MAP_COPY : FILE_MAP_READ, 0, 0, 0);
+  if (!_view) {
+    utf8 win_err[128];
+    get_errors().last_error_from_win32(win_err, 128);
+    get_errors().to_log_with_stacktrace(u8"Failed to map view of \"", path, u8"\": ", win_err);
+    close();
+    return false;
+  }
+  return true;
+}
+
+//---
+void MappedFile::close()
+{
+  if (_view) {
+    UnmapViewOfFile(_view);
+    _view = nullptr;
+  }
+  if (_mapping) {
+    CloseHandle(_mapping);
+    _mapping = nullptr;
+  }
+  if (_file) {
+    CloseHandle(_file);
+    _file = nullptr;
+  }
+  _size = 0;
+  _copy_on_write = false;
+}
+
+//---
+bool MappedFile::prefetch(u64 offset,
+                          u64 size)
+{
+  if (!_view || (offset >= _size)) {
+    return false;
+  }
+  WIN32_MEMORY_RANGE_ENTRY range;
+  range.VirtualAddress = _view + offset;
+  range.NumberOfBytes = Math::min(size, _size - offset);
+  if (!PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0)) {
+    utf8 win_err[128];
+    get_errors().last_error_from_win32(win_err, 128);
+    get_errors().to_log_with_stacktrace(u8"Failed to prefetch mapped file: ", win_err);
+    return false;
+  }
+  return true;
+}
+}
\ No newline at end of file
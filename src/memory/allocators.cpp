@@ -0,0 +1,124 @@
+#include "pathlib/memory/allocators.h"
+#include "pathlib/memory/memory.h"
+#include "pathlib/memory/slabs.h"
+#include "pathlib/memory/heap.h"
+#include "pathlib/math/math.h"
+#include "pathlib/errors/errors.h"
+#include "pathlib/win32/safe_win32.h"
+
+namespace Pathlib {
+
+//---
+ArenaAllocator::ArenaAllocator()
+{
+  _arena = &get_memory().get_scratch_arena();
+}
+
+//---
+ArenaAllocator::ArenaAllocator(_Internal::Arena& arena)
+{
+  _arena = &arena;
+}
+
+//---
+void* ArenaAllocator::allocate(u64 size,
+                               const utf8* name)
+{
+  return _arena->push(size, CACHE_LINE_SIZE);
+}
+
+//---
+void* ArenaAllocator::reallocate(void* ptr,
+                                 u64 old_size,
+                                 u64 new_size)
+{
+  /* The newest allocation grows in place; anything older is copied, and its space is reclaimed on rewind. */
+  if (new_size <= old_size) {
+    return ptr;
+  }
+  u64 end = ((u8*)ptr - _arena->_head) + old_size;
+  u64 new_end = end - old_size + new_size;
+  if ((new_end <= _arena->_capacity) && 
+      _arena->_tail.compare_and_swap(end, new_end, MemOrder::ACQ_REL)) {
+    if ((new_end > _arena->_committed.load(MemOrder::ACQUIRE)) && !_arena->commit(new_end)) {
+      return nullptr;
+    }
+    return ptr;
+  }
+  void* new_ptr = _arena->push(new_size, CACHE_LINE_SIZE);
+  if (new_ptr) {
+    memcpy_unsafe(new_ptr, ptr, old_size);
+  }
+  return new_ptr;
+}
+
+//---
+void* SlabAllocator::allocate(u64 size,
+                              const utf8* name)
+{
+  return get_slabs().allocate(size);
+}
+
+//---
+void* SlabAllocator::reallocate(void* ptr,
+                                u64 old_size,
+                                u64 new_size)
+{
+  if ((new_size <= _Internal::Slabs::MAX_BLOCK_SIZE) && 
+      (_Internal::Slabs::block_size_class(old_size) == _Internal::Slabs::block_size_class(new_size))) {
+    return ptr;
+  }
+  void* new_ptr = get_slabs().allocate(new_size);
+  if (new_ptr) {
+    memcpy_unsafe(new_ptr, ptr, Math::min(old_size, new_size));
+    get_slabs().free(ptr);
+  }
+  return new_ptr;
+}
+
+//---
+void SlabAllocator::free(void* ptr,
+                         u64 size)
+{
+  get_slabs().free(ptr);
+}
+
+//---
+static inline void check_heap_thread(const Heap* heap)
+{
+  /* mimalloc heaps are single-threaded; only freeing is allowed from other threads. */
+  if (DONT_EXPECT(heap->_owner_thread != Win32::get_current_thread_id())) {
+    get_errors().fatal(FixedStringUnsafe<256>(u8"HeapAllocator used off the thread that created heap \"", heap->_name._str, u8"\".")._str);
+  }
+}
+
+//---
+HeapAllocator::HeapAllocator(Heap& heap)
+{
+  _heap = &heap;
+}
+
+//---
+void* HeapAllocator::allocate(u64 size,
+                              const utf8* name)
+{
+  check_heap_thread(_heap);
+  return _heap->allocate(size, name);
+}
+
+//---
+void* HeapAllocator::reallocate(void* ptr,
+                                u64 old_size,
+                                u64 new_size)
+{
+  check_heap_thread(_heap);
+  return _heap->reallocate(ptr, new_size);
+}
+
+//---
+void HeapAllocator::free(void* ptr,
+                         u64 size)
+{
+  free_unsafe(&ptr);
+}
+}
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "pathlib/memory/arena.h"
 #include "pathlib/errors/errors.h"
 #include "pathlib/memory/memory.h"
+#include "pathlib/math/math.h"
 #include "../src/win32/mindows.h"
 
 namespace Pathlib::_Internal {
@@ -9,56 +10,59 @@ namespace Pathlib::_Internal {
 Arena::Arena()
 {
   _head = nullptr;
+  _tail.store(0);
+  _committed.store(0);
+  _capacity = 0;
 }
 
 //---
 Arena::~Arena()
 {
-  if (_head) {
-    _head = nullptr;
-    if (!VirtualFree(_head, 0, MEM_RELEASE)) {
-      get_errors().fatal(u8"Failed to free arena.");
-      return;
-    }
-  }
+  free();
 }
 
 //---
-bool Arena::allocate(u64 capacity)
+bool Arena::allocate(u64 capacity,
+                     bool large_pages)
 {
+  free();
   SYSTEM_INFO system_info;
   GetSystemInfo(&system_info);
-  u64 large_page_size = GetLargePageMinimum();
   u64 page_size = system_info.dwPageSize;
-  _capacity = Math::next_multiple_of_pot(capacity, page_size);
-  _tail = 0;
-  _head = (u8*)VirtualAlloc(nullptr, _capacity,
-                            MEM_RESERVE | MEM_COMMIT |
-                            MEM_LARGE_PAGES, PAGE_READWRITE);
-  if (_head) {
+  _tail.store(0, MemOrder::RELAXED);
+  if (large_pages) {
+    u64 large_page_size = GetLargePageMinimum();
+    if (large_page_size > 0) {
+      _capacity = Math::next_multiple_of_pot(capacity, large_page_size);
+      _head = (u8*)VirtualAlloc(nullptr, _capacity,
+                                MEM_RESERVE | MEM_COMMIT |
+                                MEM_LARGE_PAGES, PAGE_READWRITE);
+    }
+    if (_head) {
+      _committed.store(_capacity, MemOrder::RELEASE);
+      get_log().logt(u8"Arena created with large pages (", 
+                     large_page_size / Memory::KILOBYTE, 
+                     u8" KB), capacity: ", _capacity / Memory::KILOBYTE, u8" KB.");
+      return true;
+    }
     utf8 win_err[128];
     get_errors().last_error_from_win32(win_err, 128);
     get_log().logt(u8"Failed to allocate arena with large pages: ", win_err);
-    SYSTEM_INFO system_info;
-    GetSystemInfo(&system_info);
-    _capacity = Math::next_multiple_of_pot(capacity, (u64)system_info.dwPageSize);
-  } else {
-    get_log().logt(u8"Arena created with large pages (", 
-                   large_page_size / Memory::KILOBYTE, 
-                   u8" KB), capacity: ", capacity / Memory::KILOBYTE, u8" KB.");
-    return true;
   }
-  _head = (u8*)VirtualAlloc(nullptr, _capacity,
-                            MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+
+  /* Only address space is reserved up front; push() commits it in chunks as the tail advances. */
+  _capacity = Math::next_multiple_of_pot(capacity, page_size);
+  _head = (u8*)VirtualAlloc(nullptr, _capacity, MEM_RESERVE, PAGE_READWRITE);
   if (!_head) {
     utf8 win_err[128];
     get_errors().last_error_from_win32(win_err, 128);
-    get_errors().fatal(FixedStringUnsafe<256>(u8"Failed to allocate arena: ", win_err)._str);
+    get_errors().fatal(FixedStringUnsafe<256>(u8"Failed to reserve arena: ", win_err)._str);
     return false;
   }
-  get_log().logt(u8"Arena created without large pages (", 
+  _committed.store(0, MemOrder::RELEASE);
+  get_log().logt(u8"Arena reserved without large pages (", 
                  page_size / Memory::KILOBYTE,
-                 u8" KB), capacity: ", capacity / Memory::KILOBYTE, u8" KB.");
+                 u8" KB), capacity: ", _capacity / Memory::KILOBYTE, u8" KB.");
   return true;
 }
 
@@ -66,24 +70,62 @@ bool Arena::allocate(u64 capacity)
 void Arena::free()
 {
   if (_head) {
-    _head = nullptr;
     if (!VirtualFree(_head, 0, MEM_RELEASE)) {
       get_errors().fatal(u8"Failed to free arena.");
       return;
     }
+    _head = nullptr;
+    _tail.store(0, MemOrder::RELAXED);
+    _committed.store(0, MemOrder::RELAXED);
+    _capacity = 0;
   }
 }
 
 //---
 void* Arena::push(u64 size)
 {
-  u8* ptr = &_head[_tail.fetch_add(size, MemOrder::ACQ_REL)];
-  if (EXPECT(ptr < (_head + _capacity))) {
-    return ptr;
-  } else {
+  u64 tail = _tail.fetch_add(size, MemOrder::ACQ_REL);
+  if (DONT_EXPECT(tail > _capacity)) {
     get_errors().fatal(u8"Out of arena memory.");
     return nullptr;
   }
+  if (DONT_EXPECT(tail > _committed.load(MemOrder::ACQUIRE)) && !commit(tail)) {
+    return nullptr;
+  }
+  return &_head[tail - size];
+}
+
+//---
+void* Arena::push(u64 size,
+                  u64 alignment)
+{
+  void* ptr = try_push(size, alignment);
+  if (DONT_EXPECT(ptr == nullptr)) {
+    get_errors().fatal(u8"Out of arena memory.");
+  }
+  return ptr;
+}
+
+//---
+void* Arena::try_push(u64 size,
+                      u64 alignment)
+{
+  /* VirtualAlloc reserves at the 64KB allocation granularity, so offsets from the head share any alignment up to 64KB; only the tail needs rounding. */
+  u64 start;
+  while (true) {
+    u64 tail = _tail.load(MemOrder::RELAXED);
+    start = Math::next_multiple_of_pot(tail, alignment);
+    if (DONT_EXPECT((start + size) > _capacity)) {
+      return nullptr;
+    }
+    if (_tail.compare_and_swap(tail, start + size, MemOrder::ACQ_REL)) {
+      break;
+    }
+  }
+  if (DONT_EXPECT((start + size) > _committed.load(MemOrder::ACQUIRE)) && !commit(start + size)) {
+    return nullptr;
+  }
+  return &_head[start];
 }
 
 //---
@@ -95,10 +137,46 @@ void Arena::pop(u64 size)
   }
 }
 
-
 //---
 void Arena::clear()
 {
   _tail.store(0, MemOrder::RELEASE);
 }
+
+//---
+ArenaMarker Arena::save()
+{
+  return { _tail.load(MemOrder::ACQUIRE) };
+}
+
+//---
+void Arena::rewind(const ArenaMarker& marker)
+{
+  if (DONT_EXPECT(marker._tail > _tail.load(MemOrder::ACQUIRE))) {
+    get_errors().fatal(u8"Rewound arena past its current tail.");
+    return;
+  }
+  _tail.store(marker._tail, MemOrder::RELEASE);
+}
+
+//---
+bool Arena::commit(u64 tail)
+{
+  /* Racing pushes may commit overlapping chunks; MEM_COMMIT on committed pages is a no-op. */
+  u64 committed = _committed.load(MemOrder::ACQUIRE);
+  u64 target = Math::min(Math::next_multiple_of_pot(tail, COMMIT_CHUNK_SIZE), _capacity);
+  if (committed >= target) {
+    return true;
+  }
+  if (!VirtualAlloc(_head + committed, target - committed, MEM_COMMIT, PAGE_READWRITE)) {
+    utf8 win_err[128];
+    get_errors().last_error_from_win32(win_err, 128);
+    get_errors().fatal(FixedStringUnsafe<256>(u8"Failed to commit arena memory: ", win_err)._str);
+    return false;
+  }
+  while ((committed < target) && !_committed.compare_and_swap(committed, target, MemOrder::ACQ_REL)) {
+    committed = _committed.load(MemOrder::ACQUIRE);
+  }
+  return true;
+}
 }
\ No newline at end of file
@@ -0,0 +1,68 @@
+#include "pathlib/memory/heap.h"
+#include "pathlib/memory/malloc_unsafe.h"
+#include "pathlib/errors/errors.h"
+#include "pathlib/win32/safe_win32.h"
+#include "../src/third_party/mimalloc/mimalloc.h"
+
+namespace Pathlib {
+
+//---
+Heap::Heap(const MemoryName& name)
+  : _name(name())
+{
+  /* mimalloc heaps are owned by the creating thread; only that thread may allocate from or destroy this heap. */
+  _owner_thread = Win32::get_current_thread_id();
+  _heap = mi_heap_new();
+  if (!_heap) {
+    get_errors().to_log_with_stacktrace(u8"Failed to create heap \"", name(), u8"\".");
+  } else if (!_Internal::heap_register(_heap)) {
+    mi_heap_delete((mi_heap_t*)_heap);
+    _heap = nullptr;
+    get_errors().to_log_with_stacktrace(u8"Failed to create heap \"", name(), u8"\"; too many live heaps on this thread.");
+  }
+}
+
+//---
+Heap::~Heap()
+{
+  destroy();
+}
+
+//---
+void* Heap::allocate(u64 size,
+                     const utf8* name)
+{
+  return _Internal::heap_malloc_unsafe(_heap, size, name ? name : _name._str);
+}
+
+//---
+void* Heap::reallocate(void* ptr,
+                       u64 size)
+{
+  return _Internal::heap_realloc_unsafe(_heap, ptr, size);
+}
+
+//---
+void Heap::destroy()
+{
+  /* Every block still alive in the heap is released at once; free_unsafe() on any of them afterwards is invalid. */
+  if (_heap) {
+    _Internal::heap_forget_blocks(_heap);
+    _Internal::heap_unregister(_heap);
+    mi_heap_destroy((mi_heap_t*)_heap);
+    _heap = nullptr;
+  }
+}
+
+//---
+HeapScope::HeapScope(Heap& heap)
+{
+  _previous = _Internal::swap_current_heap(heap._heap);
+}
+
+//---
+HeapScope::~HeapScope()
+{
+  (void)_Internal::swap_current_heap(_previous);
+}
+}
\ No newline at end of file
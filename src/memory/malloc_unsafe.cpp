@@ -1,4 +1,5 @@
 #include "pathlib/memory/malloc_unsafe.h"
+#include "pathlib/memory/allocation_samples.h"
 #include "pathlib/profiler/profiler.h"
 #include "pathlib/containers/pool_unsafe.h"
 #include "../src/third_party/mimalloc/mimalloc.h"
@@ -7,34 +8,416 @@
 
 namespace Pathlib {
 
+//---
+_Internal::MemoryStats& get_memory_stats()
+{
+  static _Internal::MemoryStats memory_stats;
+  return memory_stats;
+}
+
+//---
+_Internal::AllocationSamples& get_allocation_samples()
+{
+  static _Internal::AllocationSamples allocation_samples;
+  return allocation_samples;
+}
+
+//---
+static inline bool is_sampled(const void* ptr)
+{
+  /* Sampling by address lets free and realloc skip the side table for all unsampled blocks. */
+  return ((Math::hash((u64)ptr >> 6) & (_Internal::AllocationSamples::SAMPLE_RATE - 1)) == 0);
+}
+
+//---
+static constexpr u32 MAX_LIVE_HEAPS = 64;
+static thread_local mi_heap_t* current_heap = nullptr;
+static thread_local mi_heap_t* live_heaps[MAX_LIVE_HEAPS];
+static thread_local u32 live_heap_count = 0;
+
+//---
+static inline mi_heap_t* owning_heap(void* ptr)
+{
+  for (u32 h = 0; h < live_heap_count; ++h) {
+    if (mi_heap_contains_block(live_heaps[h], ptr)) {
+      return live_heaps[h];
+    }
+  }
+  return mi_heap_get_default();
+}
+
+#if (MEMORY_TRACKING == MEMORY_TRACKING_FULL)
+
+//---
+struct AllocationHeader
+{
+  utf8 _name[_Internal::MemoryStats::NAME_SIZE];
+  u64 _size;
+  u32 _stat_index;
+  u32 _padding;
+};
+static_assert(sizeof(AllocationHeader) == 64, "AllocationHeader must stay one cache line, to keep blocks 64-byte aligned.");
+
+//---
+static inline void* heap_malloc(mi_heap_t* heap,
+                                u64 size,
+                                const utf8* name)
+{
+  AllocationHeader* header = (AllocationHeader*)mi_heap_malloc_aligned(heap, size + 64, 64);
+  if (DONT_EXPECT(!header)) {
+    return nullptr;
+  }
+  name = name ? name : u8"Unnamed";
+  u64 copy_size = Math::min((u64)(_Internal::MemoryStats::NAME_SIZE - 1), strlen(name));
+  memcpy_unsafe(header->_name, name, copy_size);
+  header->_name[copy_size] = u8'\0';
+  header->_size = size;
+  header->_stat_index = get_memory_stats().find_or_add(name);
+  get_memory_stats().add(header->_stat_index, size);
+  return (header + 1);
+}
+
+//---
+static inline void* heap_realloc(mi_heap_t* heap,
+                                 void* ptr,
+                                 u64 size)
+{
+  AllocationHeader* header = (AllocationHeader*)ptr - 1;
+  u32 stat_index = header->_stat_index;
+  u64 old_size = header->_size;
+  header = (AllocationHeader*)mi_heap_realloc_aligned(heap, header, size + 64, 64);
+  if (DONT_EXPECT(!header)) {
+    return nullptr;
+  }
+  header->_size = size;
+  get_memory_stats().sub(stat_index, old_size);
+  get_memory_stats().add(stat_index, size);
+  return (header + 1);
+}
+
+//---
+void free_unsafe(void** ptr)
+{
+  AllocationHeader* header = (AllocationHeader*)(*ptr) - 1;
+  get_memory_stats().sub(header->_stat_index, header->_size);
+  mi_free_aligned(header, 64);
+  *ptr = nullptr;
+}
+
+#else
+
+//---
+static inline void* heap_malloc(mi_heap_t* heap,
+                                u64 size,
+                                const utf8* name)
+{
+  void* ptr = mi_heap_malloc_aligned(heap, size, 64);
+  #if (MEMORY_TRACKING == MEMORY_TRACKING_SAMPLED)
+    if (DONT_EXPECT(ptr && is_sampled(ptr))) {
+      get_allocation_samples().record(ptr, size, get_memory_stats().find_or_add(name ? name : u8"Unnamed"));
+    }
+  #endif
+  return ptr;
+}
+
+//---
+static inline void* heap_realloc(mi_heap_t* heap,
+                                 void* ptr,
+                                 u64 size)
+{
+  void* new_ptr = mi_heap_realloc_aligned(heap, ptr, size, 64);
+  #if (MEMORY_TRACKING == MEMORY_TRACKING_SAMPLED)
+    _Internal::AllocationSamples::Sample sample;
+    if (DONT_EXPECT(is_sampled(ptr)) && get_allocation_samples().erase(ptr, &sample) && new_ptr && is_sampled(new_ptr)) {
+      get_allocation_samples().record(new_ptr, size, sample._stat_index);
+    }
+  #endif
+  return new_ptr;
+}
+
+//---
+void free_unsafe(void** ptr)
+{
+  #if (MEMORY_TRACKING == MEMORY_TRACKING_SAMPLED)
+    if (DONT_EXPECT(is_sampled(*ptr))) {
+      (void)get_allocation_samples().erase(*ptr);
+    }
+  #endif
+  mi_free_aligned(*ptr, 64);
+  *ptr = nullptr;
+}
+
+#endif
+
 //---
 void* malloc_unsafe(u64 size,
                     const utf8* name)
 {
-  u8* ptr = (u8*)mi_malloc_aligned(size + 64, 64);
-  if (EXPECT(name != nullptr)) {
-    u64 copy_size = Math::min(63LLU, strlen(name));
-    memcpy_unsafe(ptr, name, copy_size);
-    ptr[copy_size] = '\0';
-  } else {
-    const utf8* unnamed = u8"Unnamed";
-    memcpy_unsafe(ptr, unnamed, 7);
-    ptr[7] = '\0';
-  }
-  return (ptr + 64);
+  return heap_malloc(current_heap ? current_heap : mi_heap_get_default(), size, name);
 }
 
 //---
 void* realloc_unsafe(void* ptr,
                      u64 size)
 {
-  return (u8*)mi_realloc_aligned((u8*)ptr - 64, size + 64, 64) + 64;
+  /* A HeapScope only redirects new allocations; a block always grows in the heap it came from, inside or outside any scope. */
+  return heap_realloc(owning_heap(ptr), ptr, size);
+}
 }
 
+namespace Pathlib::_Internal {
+
 //---
-void free_unsafe(void** ptr)
+void* heap_malloc_unsafe(void* heap,
+                         u64 size,
+                         const utf8* name)
 {
-  mi_free_aligned((u8*)(*ptr) - 64, 64);
-  *ptr = nullptr;
+  return heap_malloc((mi_heap_t*)heap, size, name);
+}
+
+//---
+void* heap_realloc_unsafe(void* heap,
+                          void* ptr,
+                          u64 size)
+{
+  return heap_realloc((mi_heap_t*)heap, ptr, size);
+}
+
+//---
+bool heap_register(void* heap)
+{
+  if (live_heap_count == MAX_LIVE_HEAPS) {
+    return false;
+  }
+  live_heaps[live_heap_count++] = (mi_heap_t*)heap;
+  return true;
+}
+
+//---
+void heap_unregister(void* heap)
+{
+  for (u32 h = 0; h < live_heap_count; ++h) {
+    if (live_heaps[h] == (mi_heap_t*)heap) {
+      live_heaps[h] = live_heaps[--live_heap_count];
+      return;
+    }
+  }
+}
+
+//---
+void* swap_current_heap(void* heap)
+{
+  mi_heap_t* previous = current_heap;
+  current_heap = (mi_heap_t*)heap;
+  return previous;
+}
+
+//---
+static bool forget_block(const mi_heap_t* heap,
+                         const mi_heap_area_t* area,
+                         void* block,
+                         size_t block_size,
+                         void* arg)
+{
+  if (block) {
+    #if (MEMORY_TRACKING == MEMORY_TRACKING_FULL)
+      AllocationHeader* header = (AllocationHeader*)Math::align_next<64>(block);
+      get_memory_stats().sub(header->_stat_index, header->_size);
+    #elif (MEMORY_TRACKING == MEMORY_TRACKING_SAMPLED)
+      void* ptr = Math::align_next<64>(block);
+      if (is_sampled(ptr)) {
+        (void)get_allocation_samples().erase(ptr);
+      }
+    #endif
+  }
+  return true;
+}
+
+//---
+void heap_forget_blocks(void* heap)
+{
+  /* Blocks released by a bulk destroy never pass through free_unsafe(); settle their tracking first. */
+  #if (MEMORY_TRACKING != MEMORY_TRACKING_OFF)
+    mi_heap_visit_blocks((mi_heap_t*)heap, true, forget_block, nullptr);
+  #endif
+}
+
+//---
+MemoryStats::MemoryStats()
+{
+  for (u32 e = 0; e <= MAX_NAMES; ++e) {
+    _entries[e]._state.store(EMPTY, MemOrder::RELAXED);
+    _entries[e]._live_bytes.store(0, MemOrder::RELAXED);
+    _entries[e]._live_count.store(0, MemOrder::RELAXED);
+    _entries[e]._peak_bytes.store(0, MemOrder::RELAXED);
+  }
+  const utf8* overflow_name = u8"Untracked (too many names)";
+  memcpy_unsafe(_entries[OVERFLOW_INDEX]._name, overflow_name, strlen(overflow_name) + 1);
+  _entries[OVERFLOW_INDEX]._state.store(READY, MemOrder::RELEASE);
+}
+
+//---
+u32 MemoryStats::find_or_add(const utf8* name)
+{
+  /* Entries are only ever added, so a published name can be compared without locking. */
+  u64 name_size = Math::min((u64)(NAME_SIZE - 1), strlen(name));
+  u32 name_hash = Math::hash(name, name_size);
+  u32 index = name_hash & (MAX_NAMES - 1);
+  for (u32 probe = 0; probe < MAX_NAMES; ++probe) {
+    Entry& entry = _entries[index];
+    u32 state = entry._state.load(MemOrder::ACQUIRE);
+    if (state == EMPTY) {
+      if (!entry._state.compare_and_swap(EMPTY, WRITING, MemOrder::ACQUIRE)) {
+        --probe;
+        continue;
+      }
+      entry._hash = name_hash;
+      memcpy_unsafe(entry._name, name, name_size);
+      entry._name[name_size] = u8'\0';
+      entry._state.store(READY, MemOrder::RELEASE);
+      return index;
+    }
+    if (state == WRITING) {
+      __builtin_ia32_pause();
+      --probe;
+      continue;
+    }
+    if ((entry._hash == name_hash) && (entry._name[name_size] == u8'\0')) {
+      u64 c = 0;
+      while ((c < name_size) && (entry._name[c] == name[c])) {
+        ++c;
+      }
+      if (c == name_size) {
+        return index;
+      }
+    }
+    index = (index + 1) & (MAX_NAMES - 1);
+  }
+  return OVERFLOW_INDEX;
+}
+
+//---
+void MemoryStats::add(u32 index,
+                      u64 size,
+                      u64 count)
+{
+  Entry& entry = _entries[index];
+  u64 live_bytes = entry._live_bytes.fetch_add(size, MemOrder::RELAXED);
+  entry._live_count.fetch_add(count, MemOrder::RELAXED);
+  u64 peak_bytes = entry._peak_bytes.load(MemOrder::RELAXED);
+  while ((live_bytes > peak_bytes) && !entry._peak_bytes.compare_and_swap(peak_bytes, live_bytes, MemOrder::RELAXED)) {
+    peak_bytes = entry._peak_bytes.load(MemOrder::RELAXED);
+  }
+}
+
+//---
+void MemoryStats::sub(u32 index,
+                      u64 size,
+                      u64 count)
+{
+  _entries[index]._live_bytes.fetch_sub(size, MemOrder::RELAXED);
+  _entries[index]._live_count.fetch_sub(count, MemOrder::RELAXED);
+}
+
+//---
+static inline u32 sample_slot(u64 address,
+                              u32 capacity)
+{
+  return (Math::hash(address >> 6) & (capacity - 1));
+}
+
+//---
+AllocationSamples::AllocationSamples()
+{
+  /* The side table allocates straight from mimalloc, so recording a sample never re-enters malloc_unsafe(). */
+  _capacity = RESERVE_CAPACITY;
+  _count = 0;
+  _samples = (Sample*)mi_zalloc(sizeof(Sample) * _capacity);
+}
+
+//---
+AllocationSamples::~AllocationSamples()
+{
+  mi_free(_samples);
+}
+
+//---
+void AllocationSamples::record(const void* ptr,
+                               u64 size,
+                               u32 stat_index)
+{
+  /* Each sample stands in for SAMPLE_RATE blocks, so the per-name stats are estimates. */
+  get_memory_stats().add(stat_index, size * SAMPLE_RATE, SAMPLE_RATE);
+  _lock.acquire();
+  if (((_count + 1) * 4) > (_capacity * 3)) {
+    grow();
+  }
+  u32 mask = _capacity - 1;
+  u32 slot = sample_slot((u64)ptr, _capacity);
+  while ((_samples[slot]._address != 0) && (_samples[slot]._address != (u64)ptr)) {
+    slot = (slot + 1) & mask;
+  }
+  if (_samples[slot]._address == 0) {
+    ++_count;
+  }
+  _samples[slot] = { (u64)ptr, size, stat_index };
+  _lock.release();
+}
+
+//---
+bool AllocationSamples::erase(const void* ptr,
+                              Sample* sample_out)
+{
+  _lock.acquire();
+  u32 mask = _capacity - 1;
+  u32 slot = sample_slot((u64)ptr, _capacity);
+  while (_samples[slot]._address != (u64)ptr) {
+    if (_samples[slot]._address == 0) {
+      _lock.release();
+      return false;
+    }
+    slot = (slot + 1) & mask;
+  }
+  Sample sample = _samples[slot];
+
+  /* Backward-shift deletion keeps probe chains intact without tombstones. */
+  u32 hole = slot;
+  u32 next = (slot + 1) & mask;
+  while (_samples[next]._address != 0) {
+    u32 home = sample_slot(_samples[next]._address, _capacity);
+    if (((next - home) & mask) >= ((next - hole) & mask)) {
+      _samples[hole] = _samples[next];
+      hole = next;
+    }
+    next = (next + 1) & mask;
+  }
+  _samples[hole]._address = 0;
+  --_count;
+  _lock.release();
+  get_memory_stats().sub(sample._stat_index, sample._size * SAMPLE_RATE, SAMPLE_RATE);
+  if (sample_out) {
+    *sample_out = sample;
+  }
+  return true;
+}
+
+//---
+void AllocationSamples::grow()
+{
+  u32 old_capacity = _capacity;
+  Sample* old_samples = _samples;
+  _capacity <<= 1;
+  _samples = (Sample*)mi_zalloc(sizeof(Sample) * _capacity);
+  u32 mask = _capacity - 1;
+  for (u32 s = 0; s < old_capacity; ++s) {
+    if (old_samples[s]._address != 0) {
+      u32 slot = sample_slot(old_samples[s]._address, _capacity);
+      while (_samples[slot]._address != 0) {
+        slot = (slot + 1) & mask;
+      }
+      _samples[slot] = old_samples[s];
+    }
+  }
+  mi_free(old_samples);
 }
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "../src/win32/mindows.h"
 #include "pathlib/errors/errors.h"
 #include "pathlib/memory/memory.h"
+#include "pathlib/math/math.h"
 
 namespace Pathlib {
 
@@ -14,21 +15,65 @@ _Internal::Memory& get_memory()
 
 namespace Pathlib::_Internal {
 
+//---
+static thread_local u32 current_scratch_arena = Memory::NO_SCRATCH_ARENA;
+
 //---
 Memory::Memory()
 {
   enable_large_pages();
-  scoped_arena.allocate(100 * MEGABYTE);
   persistent_arena.allocate(100 * MEGABYTE);
+
+  /* Slots past scratch_count start claimed, so a slot is never handed out before its creator has allocated it. */
+  for (u32 a = 0; a < MAX_SCRATCH_ARENAS; ++a) {
+    scratch_in_use[a].store(1);
+  }
+  scratch_count.store(0);
 }
 
 //---
 Memory::~Memory() 
 {
-  scoped_arena.free();
+  u32 arena_count = Math::min(scratch_count.load(MemOrder::ACQUIRE), MAX_SCRATCH_ARENAS);
+  for (u32 a = 0; a < arena_count; ++a) {
+    scratch_arenas[a]->free();
+  }
   persistent_arena.free();
 }
 
+//---
+Arena& Memory::get_scratch_arena()
+{
+  if (EXPECT(current_scratch_arena != NO_SCRATCH_ARENA)) {
+    return *scratch_arenas[current_scratch_arena];
+  }
+  u32 arena_count = Math::min(scratch_count.load(MemOrder::ACQUIRE), MAX_SCRATCH_ARENAS);
+  for (u32 a = 0; a < arena_count; ++a) {
+    if (scratch_in_use[a].compare_and_swap(0, 1, MemOrder::ACQUIRE)) {
+      current_scratch_arena = a;
+      return *scratch_arenas[a];
+    }
+  }
+  u32 arena_index = scratch_count.fetch_add(1, MemOrder::ACQ_REL) - 1;
+  if (DONT_EXPECT(arena_index >= MAX_SCRATCH_ARENAS)) {
+    get_errors().fatal(u8"Ran out of scratch arenas; threads must call release_scratch_arena() before exiting.");
+  }
+  scratch_arenas[arena_index]->allocate(SCRATCH_ARENA_CAPACITY);
+  current_scratch_arena = arena_index;
+  return *scratch_arenas[arena_index];
+}
+
+//---
+void Memory::release_scratch_arena()
+{
+  if (current_scratch_arena == NO_SCRATCH_ARENA) {
+    return;
+  }
+  scratch_arenas[current_scratch_arena]->clear();
+  scratch_in_use[current_scratch_arena].store(0, MemOrder::RELEASE);
+  current_scratch_arena = NO_SCRATCH_ARENA;
+}
+
 //---
 bool Memory::enable_large_pages()
 {
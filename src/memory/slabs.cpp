@@ -0,0 +1,153 @@
+#include "pathlib/memory/slabs.h"
+#include "pathlib/memory/malloc_unsafe.h"
+#include "pathlib/memory/memset_unsafe.h"
+#include "pathlib/math/math.h"
+#include "pathlib/errors/errors.h"
+
+namespace Pathlib {
+
+//---
+_Internal::Slabs& get_slabs()
+{
+  static _Internal::Slabs slabs;
+  return slabs;
+}
+}
+
+namespace Pathlib::_Internal {
+
+//---
+static thread_local u32 current_thread_cache = Slabs::NO_THREAD_CACHE;
+
+//---
+Slabs::Slabs()
+{
+  _arena.allocate(ARENA_CAPACITY);
+
+  /* Slab headers are found by masking a block address, which relies on the reservation's 64KB allocation granularity. */
+  if (DONT_EXPECT((u64)_arena._head & (SLAB_SIZE - 1))) {
+    get_errors().fatal(u8"Slabs arena is not aligned to SLAB_SIZE.");
+  }
+  memset_unsafe(_thread_caches, 0, sizeof(_thread_caches));
+
+  /* Slots past _thread_cache_count start claimed, so a cache is never handed out before it is created. */
+  for (u32 c = 0; c < MAX_THREAD_CACHES; ++c) {
+    _thread_cache_in_use[c].store(1);
+  }
+  _thread_cache_count.store(0);
+}
+
+//---
+Slabs::~Slabs()
+{
+  u32 cache_count = Math::min(_thread_cache_count.load(MemOrder::ACQUIRE), MAX_THREAD_CACHES);
+  for (u32 c = 0; c < cache_count; ++c) {
+    if (_thread_caches[c]) {
+      free_unsafe((void**)&_thread_caches[c]);
+    }
+  }
+  _arena.free();
+}
+
+//---
+u32 Slabs::get_thread_cache_index()
+{
+  if (EXPECT(current_thread_cache != NO_THREAD_CACHE)) {
+    return current_thread_cache;
+  }
+  u32 cache_count = Math::min(_thread_cache_count.load(MemOrder::ACQUIRE), MAX_THREAD_CACHES);
+  for (u32 c = 0; c < cache_count; ++c) {
+    if (_thread_cache_in_use[c].compare_and_swap(0, 1, MemOrder::ACQUIRE)) {
+      current_thread_cache = c;
+      return c;
+    }
+  }
+  u32 cache_index = _thread_cache_count.fetch_add(1, MemOrder::ACQ_REL) - 1;
+  if (DONT_EXPECT(cache_index >= MAX_THREAD_CACHES)) {
+    get_errors().fatal(u8"Slabs ran out of thread caches; threads must call release_thread_cache() before exiting.");
+  }
+  ThreadCache* cache = (ThreadCache*)malloc_unsafe(sizeof(ThreadCache), u8"Slabs::_thread_caches");
+  memset_unsafe(cache->_magazines, 0, sizeof(cache->_magazines));
+  for (u32 s = 0; s < SIZE_CLASS_COUNT; ++s) {
+    cache->_remote_frees[s]->store(0, MemOrder::RELAXED);
+  }
+  __atomic_store_n(&_thread_caches[cache_index], cache, MemOrder::RELEASE);
+  current_thread_cache = cache_index;
+  return cache_index;
+}
+
+//---
+void* Slabs::allocate(u64 size)
+{
+  if (DONT_EXPECT(size > MAX_BLOCK_SIZE)) {
+    return malloc_unsafe(size, u8"Slabs::_large_blocks");
+  }
+  u32 size_class = block_size_class(size);
+  u32 cache_index = get_thread_cache_index();
+  ThreadCache& cache = *_thread_caches[cache_index];
+  Magazine& magazine = cache._magazines[size_class];
+  FreeBlock* block = magazine._free_head;
+  if (EXPECT(block != nullptr)) {
+    magazine._free_head = block->_next;
+    return block;
+  }
+
+  /* Blocks freed by other threads are only taken back, in one swap, once the local list runs dry. */
+  block = (FreeBlock*)cache._remote_frees[size_class]->swap(0, MemOrder::ACQUIRE);
+  if (block) {
+    magazine._free_head = block->_next;
+    return block;
+  }
+  u64 block_size = MIN_BLOCK_SIZE << size_class;
+  if (DONT_EXPECT((u64)(magazine._bump_end - magazine._bump) < block_size)) {
+    SlabHeader* slab = (SlabHeader*)_arena.push(SLAB_SIZE, SLAB_SIZE);
+    if (!slab) {
+      return nullptr;
+    }
+    slab->_size_class = size_class;
+    slab->_owner = cache_index;
+    magazine._bump = (u8*)slab + SLAB_HEADER_SIZE;
+    magazine._bump_end = (u8*)slab + SLAB_SIZE;
+  }
+  void* ptr = magazine._bump;
+  magazine._bump += block_size;
+  return ptr;
+}
+
+//---
+void Slabs::free(void* ptr)
+{
+  if (DONT_EXPECT(!owns(ptr))) {
+    free_unsafe(&ptr);
+    return;
+  }
+  SlabHeader* slab = (SlabHeader*)((u64)ptr & ~(SLAB_SIZE - 1));
+  FreeBlock* block = (FreeBlock*)ptr;
+  if (EXPECT(slab->_owner == current_thread_cache)) {
+    Magazine& magazine = _thread_caches[current_thread_cache]->_magazines[slab->_size_class];
+    block->_next = magazine._free_head;
+    magazine._free_head = block;
+    return;
+  }
+  Atomic<u64>& remote_frees = *_thread_caches[slab->_owner]->_remote_frees[slab->_size_class];
+  u64 head = remote_frees.load(MemOrder::RELAXED);
+  while (true) {
+    block->_next = (FreeBlock*)head;
+    if (remote_frees.compare_and_swap(head, (u64)block, MemOrder::RELEASE)) {
+      return;
+    }
+    head = remote_frees.load(MemOrder::RELAXED);
+  }
+}
+
+//---
+void Slabs::release_thread_cache()
+{
+  /* The cache keeps its slabs and free lists; whichever thread claims it next inherits them. */
+  if (current_thread_cache == NO_THREAD_CACHE) {
+    return;
+  }
+  _thread_cache_in_use[current_thread_cache].store(0, MemOrder::RELEASE);
+  current_thread_cache = NO_THREAD_CACHE;
+}
+}
\ No newline at end of file
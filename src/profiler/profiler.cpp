@@ -21,32 +21,20 @@ Profiler::Profiler()
 }
 
 //---
-static bool list_memory_callback(const mi_heap_t* heap, 
-                                 const mi_heap_area_t* area, 
-                                 void* block, 
-                                 size_t block_size, 
-                                 void* arg) 
+void Profiler::list_memory(VectorUnsafe<MemoryStat, 128>& stats_out)
 {
-  void** out = (void**)arg;
-  VectorUnsafe<FixedStringUnsafe<64>, 128>* names_out = (VectorUnsafe<FixedStringUnsafe<64>, 128>*)out[0];
-  VectorUnsafe<u64, 128>* sizes_out = (VectorUnsafe<u64, 128>*)out[1];
-  
-  if (block && (block_size > 64)) {
-    void* aligned_ptr = Math::align_next<64>(block);
-    utf8 name[64];
-    memcpy_unsafe(name, aligned_ptr, 64);
-    name[63] = u8'\0';
-    *names_out->emplace_back(1) = name;
-    *sizes_out->emplace_back(1) = block_size;
+  /* Counters are bumped on every alloc/realloc/free, so a snapshot only visits the registered names. */
+  MemoryStats& memory_stats = get_memory_stats();
+  for (u32 e = 0; e <= MemoryStats::MAX_NAMES; ++e) {
+    MemoryStats::Entry& entry = memory_stats._entries[e];
+    if ((entry._state.load(MemOrder::ACQUIRE) != MemoryStats::READY) || (entry._peak_bytes.load(MemOrder::RELAXED) == 0)) {
+      continue;
+    }
+    MemoryStat* stat = stats_out.emplace_back(1);
+    stat->_name = entry._name;
+    stat->_live_bytes = entry._live_bytes.load(MemOrder::RELAXED);
+    stat->_live_count = entry._live_count.load(MemOrder::RELAXED);
+    stat->_peak_bytes = entry._peak_bytes.load(MemOrder::RELAXED);
   }
-  return true;
-}
-
-//---
-void Profiler::list_memory(VectorUnsafe<FixedStringUnsafe<64>, 128>& names_out,
-                           VectorUnsafe<u64, 128>& sizes_out)
-{
-  void* out[2] = { &names_out, &sizes_out };
-  mi_heap_visit_blocks(mi_heap_get_default(), true, list_memory_callback, out);
 }
 }
\ No newline at end of file
@@ -0,0 +1,168 @@
+#include "pathlib/timer/timing_wheel.h"
+#include "pathlib/timer/timer.h"
+#include "pathlib/math/math.h"
+#include "pathlib/memory/malloc_unsafe.h"
+#include "pathlib/memory/memset_unsafe.h"
+#include "pathlib/string/fixed_string_unsafe.h"
+
+namespace Pathlib {
+
+//---
+TimingWheel::TimingWheel(const MemoryName& name)
+{
+  _node_capacity = RESERVE_CAPACITY;
+  _node_count = 0;
+  _free_head = NO_NODE;
+  _count = 0;
+  _current_ms = get_timer().now_ms();
+  _nodes = (Node*)malloc_unsafe(sizeof(Node) * _node_capacity,
+                                FixedStringUnsafe<64>(u8"\"", name(), u8"\"::_nodes")._str);
+  memset_unsafe(_slots, 0xFF, sizeof(_slots));
+}
+
+//---
+TimingWheel::~TimingWheel()
+{
+  if (_nodes) {
+    free_unsafe((void**)&_nodes);
+  }
+}
+
+//---
+u64 TimingWheel::schedule(u64 delay_ms,
+                          TimerCallback callback,
+                          void* user_data)
+{
+  u32 node_index;
+  if (_free_head != NO_NODE) {
+    node_index = _free_head;
+    _free_head = _nodes[node_index]._next;
+  } else {
+    if (_node_count == _node_capacity) {
+      _node_capacity <<= 1;
+      _nodes = (Node*)realloc_unsafe(_nodes, sizeof(Node) * _node_capacity);
+    }
+    node_index = _node_count++;
+    _nodes[node_index]._generation = 0;
+  }
+  Node& node = _nodes[node_index];
+  node._deadline_ms = _current_ms + Math::max(delay_ms, 1ULL);
+  node._callback = callback;
+  node._user_data = user_data;
+  link(node_index);
+  ++_count;
+  return (((u64)node._generation << 32) | node_index);
+}
+
+//---
+bool TimingWheel::cancel(u64 handle)
+{
+  u32 node_index = (u32)handle;
+  if ((handle == INVALID_HANDLE) || (node_index >= _node_count) ||
+      (_nodes[node_index]._generation != (u32)(handle >> 32)) || (_nodes[node_index]._slot == NO_NODE)) {
+    return false;
+  }
+  unlink(node_index);
+  release(node_index);
+  return true;
+}
+
+//---
+u32 TimingWheel::advance()
+{
+  return advance_to(get_timer().now_ms());
+}
+
+//---
+u32 TimingWheel::advance_to(u64 now_ms)
+{
+  u32 fired = 0;
+  while (_current_ms < now_ms) {
+    if (_count == 0) {
+      _current_ms = now_ms;
+      break;
+    }
+    ++_current_ms;
+
+    /* Each time a level wraps, the next level's current slot is redistributed into the levels below. */
+    for (u32 level = 1; level < LEVEL_COUNT; ++level) {
+      if ((_current_ms & ((1ULL << (SLOT_BITS * level)) - 1)) != 0) {
+        break;
+      }
+      cascade(level);
+    }
+    u32& slot_head = _slots[_current_ms & SLOT_MASK];
+    while (slot_head != NO_NODE) {
+      u32 node_index = slot_head;
+      TimerCallback callback = _nodes[node_index]._callback;
+      void* user_data = _nodes[node_index]._user_data;
+      unlink(node_index);
+      release(node_index);
+      callback(user_data);
+      ++fired;
+    }
+  }
+  return fired;
+}
+
+//---
+void TimingWheel::link(u32 node_index)
+{
+  Node& node = _nodes[node_index];
+  u64 deadline_ms = Math::max(node._deadline_ms, _current_ms);
+  u64 delta_ms = deadline_ms - _current_ms;
+  u32 level = 0;
+  while ((level < (LEVEL_COUNT - 1)) && (delta_ms >= (1ULL << (SLOT_BITS * (level + 1))))) {
+    ++level;
+  }
+  if (delta_ms >= (1ULL << (SLOT_BITS * LEVEL_COUNT))) {
+    deadline_ms = _current_ms + (1ULL << (SLOT_BITS * LEVEL_COUNT)) - 1;
+  }
+  u32 slot = (level * SLOT_COUNT) + ((deadline_ms >> (SLOT_BITS * level)) & SLOT_MASK);
+  node._slot = slot;
+  node._previous = NO_NODE;
+  node._next = _slots[slot];
+  if (node._next != NO_NODE) {
+    _nodes[node._next]._previous = node_index;
+  }
+  _slots[slot] = node_index;
+}
+
+//---
+void TimingWheel::unlink(u32 node_index)
+{
+  Node& node = _nodes[node_index];
+  if (node._previous != NO_NODE) {
+    _nodes[node._previous]._next = node._next;
+  } else {
+    _slots[node._slot] = node._next;
+  }
+  if (node._next != NO_NODE) {
+    _nodes[node._next]._previous = node._previous;
+  }
+  node._slot = NO_NODE;
+}
+
+//---
+void TimingWheel::release(u32 node_index)
+{
+  Node& node = _nodes[node_index];
+  ++node._generation;
+  node._next = _free_head;
+  _free_head = node_index;
+  --_count;
+}
+
+//---
+void TimingWheel::cascade(u32 level)
+{
+  u32 slot = (level * SLOT_COUNT) + ((_current_ms >> (SLOT_BITS * level)) & SLOT_MASK);
+  u32 node_index = _slots[slot];
+  _slots[slot] = NO_NODE;
+  while (node_index != NO_NODE) {
+    u32 next = _nodes[node_index]._next;
+    link(node_index);
+    node_index = next;
+  }
+}
+}
\ No newline at end of file
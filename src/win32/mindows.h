@@ -14,6 +14,13 @@
 #define CREATE_ALWAYS 2
 #define FILE_ATTRIBUTE_NORMAL 0x80
 #define GENERIC_WRITE 0x40000000L
+#define GENERIC_READ 0x80000000L
+#define OPEN_EXISTING 3
+#define OPEN_ALWAYS 4
+#define FILE_SHARE_READ 0x00000001
+#define FILE_FLAG_OVERLAPPED 0x40000000
+#define FILE_FLAG_SEQUENTIAL_SCAN 0x08000000
+#define FILE_FLAG_RANDOM_ACCESS 0x10000000
 #define INVALID_HANDLE_VALUE ((HANDLE)(LONG_PTR)-1)
 #define FORMAT_MESSAGE_ALLOCATE_BUFFER 0x00000100
 #define FORMAT_MESSAGE_FROM_SYSTEM  0x00001000
@@ -29,6 +36,10 @@
 #define MEM_RESERVE 0x00002000
 #define MEM_LARGE_PAGES 0x20000000
 #define PAGE_READWRITE 0x04
+#define PAGE_READONLY 0x02
+#define PAGE_WRITECOPY 0x08
+#define FILE_MAP_COPY 0x0001
+#define FILE_MAP_READ 0x0004
 #define MEM_RELEASE 0x00008000
 #define ANYSIZE_ARRAY 1
 #define TOKEN_ADJUST_PRIVILEGES 0x0020
@@ -36,6 +47,8 @@
 #define TEXT(quote) L##quote
 #define SE_LOCK_MEMORY_NAME TEXT("SeLockMemoryPrivilege")
 #define ERROR_SUCCESS 0L
+#define CREATE_SUSPENDED 0x00000004
+#define STACK_SIZE_PARAM_IS_A_RESERVATION 0x00010000
 
 //---
 #define ERROR_IO_PENDING 0x3E5
@@ -79,6 +92,9 @@ typedef HANDLE* PHANDLE;
 typedef DWORD* PDWORD;
 typedef LPCWSTR LPCTSTR;
 typedef unsigned long long DWORD_PTR;
+typedef DWORD_PTR* PDWORD_PTR;
+typedef unsigned long long ULONG_PTR;
+typedef unsigned long long KAFFINITY;
 
 extern "C" {
 
@@ -171,6 +187,41 @@ typedef struct _SYSTEM_INFO {
   WORD wProcessorRevision;
 } SYSTEM_INFO, * LPSYSTEM_INFO;
 
+//---
+typedef struct _OVERLAPPED {
+  ULONG_PTR Internal;
+  ULONG_PTR InternalHigh;
+  union {
+    struct {
+      DWORD Offset;
+      DWORD OffsetHigh;
+    };
+    PVOID Pointer;
+  };
+  HANDLE hEvent;
+} OVERLAPPED, *LPOVERLAPPED;
+
+//---
+typedef struct _OVERLAPPED_ENTRY {
+  ULONG_PTR lpCompletionKey;
+  LPOVERLAPPED lpOverlapped;
+  ULONG_PTR Internal;
+  DWORD dwNumberOfBytesTransferred;
+} OVERLAPPED_ENTRY, *LPOVERLAPPED_ENTRY;
+
+//---
+typedef struct _WIN32_MEMORY_RANGE_ENTRY {
+  PVOID VirtualAddress;
+  SIZE_T NumberOfBytes;
+} WIN32_MEMORY_RANGE_ENTRY, *PWIN32_MEMORY_RANGE_ENTRY;
+
+//---
+typedef struct _GROUP_AFFINITY {
+  KAFFINITY Mask;
+  WORD Group;
+  WORD Reserved[3];
+} GROUP_AFFINITY, *PGROUP_AFFINITY;
+
 //---
 __declspec(dllimport) HANDLE __stdcall GetCurrentProcess();
 __declspec(dllimport) void __stdcall GetSystemInfo(LPSYSTEM_INFO lpSystemInfo);
@@ -182,6 +233,22 @@ __declspec(dllimport) BOOL __stdcall VirtualFree(LPVOID lpAddress,
                                                  SIZE_T dwSize,
                                                  DWORD  dwFreeType);
 __declspec(dllimport) SIZE_T __stdcall GetLargePageMinimum();
+__declspec(dllimport) HANDLE __stdcall CreateFileMappingW(HANDLE hFile,
+                                                          LPSECURITY_ATTRIBUTES lpFileMappingAttributes,
+                                                          DWORD flProtect,
+                                                          DWORD dwMaximumSizeHigh,
+                                                          DWORD dwMaximumSizeLow,
+                                                          LPCWSTR lpName);
+__declspec(dllimport) LPVOID __stdcall MapViewOfFile(HANDLE hFileMappingObject,
+                                                     DWORD dwDesiredAccess,
+                                                     DWORD dwFileOffsetHigh,
+                                                     DWORD dwFileOffsetLow,
+                                                     SIZE_T dwNumberOfBytesToMap);
+__declspec(dllimport) BOOL __stdcall UnmapViewOfFile(LPCVOID lpBaseAddress);
+__declspec(dllimport) BOOL __stdcall PrefetchVirtualMemory(HANDLE hProcess,
+                                                           ULONG_PTR NumberOfEntries,
+                                                           PWIN32_MEMORY_RANGE_ENTRY VirtualAddresses,
+                                                           ULONG Flags);
 __declspec(dllimport) BOOL __stdcall OpenProcessToken(HANDLE ProcessHandle,
                                                       DWORD DesiredAccess,
                                                       PHANDLE TokenHandle);
@@ -196,6 +263,7 @@ __declspec(dllimport) BOOL __stdcall LookupPrivilegeValueW(LPCTSTR lpSystemName,
                                                            PLUID   lpLuid);
 __declspec(dllimport) DWORD __stdcall GetCurrentThreadId();
 __declspec(dllimport) BOOL __stdcall SwitchToThread();
+__declspec(dllimport) DWORD __stdcall GetCurrentProcessorNumber();
 __declspec(dllimport) BOOL __stdcall GetExitCodeThread(HANDLE  hThread,
                                                        LPDWORD lpExitCode);
 __declspec(dllimport) HANDLE __stdcall CreateThread(LPSECURITY_ATTRIBUTES lpThreadAttributes,
@@ -204,11 +272,31 @@ __declspec(dllimport) HANDLE __stdcall CreateThread(LPSECURITY_ATTRIBUTES lpThre
                                                     LPVOID lpParameter,
                                                     DWORD dwCreationFlags,
                                                     LPDWORD lpThreadId);
+__declspec(dllimport) DWORD __stdcall ResumeThread(HANDLE hThread);
+__declspec(dllimport) BOOL __stdcall SetThreadGroupAffinity(HANDLE hThread,
+                                                            const GROUP_AFFINITY* GroupAffinity,
+                                                            PGROUP_AFFINITY PreviousGroupAffinity);
+__declspec(dllimport) BOOL __stdcall GetNumaNodeProcessorMaskEx(USHORT Node,
+                                                                PGROUP_AFFINITY ProcessorMask);
+__declspec(dllimport) BOOL __stdcall GetThreadGroupAffinity(HANDLE hThread,
+                                                            PGROUP_AFFINITY GroupAffinity);
+__declspec(dllimport) HANDLE __stdcall GetCurrentThread();
+__declspec(dllimport) BOOL __stdcall GetProcessAffinityMask(HANDLE hProcess,
+                                                            PDWORD_PTR lpProcessAffinityMask,
+                                                            PDWORD_PTR lpSystemAffinityMask);
+__declspec(dllimport) WORD __stdcall GetActiveProcessorGroupCount();
+__declspec(dllimport) DWORD __stdcall GetActiveProcessorCount(WORD GroupNumber);
 __declspec(dllimport) BOOL __stdcall TerminateThread(HANDLE hThread,
                                                      DWORD dwExitCode);
 __declspec(dllimport) DWORD WaitForSingleObject(HANDLE hHandle,
                                                 DWORD dwMilliseconds);
 __declspec(dllimport) void __stdcall Sleep(DWORD dwMilliseconds);
+__declspec(dllimport) BOOL __stdcall WaitOnAddress(volatile void* Address,
+                                                   PVOID CompareAddress,
+                                                   SIZE_T AddressSize,
+                                                   DWORD dwMilliseconds);
+__declspec(dllimport) void __stdcall WakeByAddressSingle(PVOID Address);
+__declspec(dllimport) void __stdcall WakeByAddressAll(PVOID Address);
 __declspec(dllimport) BOOL __stdcall SymInitialize(HANDLE hProcess,
                                                    PCSTR UserSearchPath,
                                                    BOOL fInvadeProcess);
@@ -217,6 +305,7 @@ __declspec(dllimport) USHORT __stdcall RtlCaptureStackBackTrace(ULONG FramesToSk
                                                                 ULONG FramesToCapture,
                                                                 PVOID* BackTrace,
                                                                 PULONG BackTraceHash);
+__declspec(dllimport) ULONG __stdcall RtlNtStatusToDosError(LONG Status);
 __declspec(dllimport) BOOL __stdcall SymFromAddr(HANDLE hProcess,
                                                  DWORD64 Address,
                                                  PDWORD64 Displacement,
@@ -238,6 +327,27 @@ __declspec(dllimport) HANDLE __stdcall CreateFileW(const wchar_t* lpFileName,
                                                    HANDLE hTemplateFile);
 __declspec(dllimport) int __stdcall WriteFile(HANDLE hFile, const HANDLE lpBuffer, DWORD nNumberOfBytesToWrite,
                                               DWORD* lpNumberOfBytesWritten, void* ignore);
+__declspec(dllimport) BOOL __stdcall ReadFile(HANDLE hFile,
+                                              LPVOID lpBuffer,
+                                              DWORD nNumberOfBytesToRead,
+                                              LPDWORD lpNumberOfBytesRead,
+                                              LPOVERLAPPED lpOverlapped);
+__declspec(dllimport) BOOL __stdcall GetFileSizeEx(HANDLE hFile,
+                                                   LARGE_INTEGER* lpFileSize);
+__declspec(dllimport) HANDLE __stdcall CreateIoCompletionPort(HANDLE FileHandle,
+                                                              HANDLE ExistingCompletionPort,
+                                                              ULONG_PTR CompletionKey,
+                                                              DWORD NumberOfConcurrentThreads);
+__declspec(dllimport) BOOL __stdcall GetQueuedCompletionStatusEx(HANDLE CompletionPort,
+                                                                 LPOVERLAPPED_ENTRY lpCompletionPortEntries,
+                                                                 ULONG ulCount,
+                                                                 PULONG ulNumEntriesRemoved,
+                                                                 DWORD dwMilliseconds,
+                                                                 BOOL fAlertable);
+__declspec(dllimport) BOOL __stdcall PostQueuedCompletionStatus(HANDLE CompletionPort,
+                                                                DWORD dwNumberOfBytesTransferred,
+                                                                ULONG_PTR dwCompletionKey,
+                                                                LPOVERLAPPED lpOverlapped);
 __declspec(dllimport) int __stdcall QueryPerformanceFrequency(LARGE_INTEGER* lpFrequency);
 __declspec(dllimport) int __stdcall QueryPerformanceCounter(LARGE_INTEGER *lpPerformanceCount);
 __declspec(dllimport) DWORD __stdcall GetLastError();
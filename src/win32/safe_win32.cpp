@@ -4,6 +4,7 @@
 #include "pathlib/log/log.h"
 
 #pragma comment(lib, "Dbghelp.lib")
+#pragma comment(lib, "Synchronization.lib")
 
 namespace Pathlib::Win32 { 
 
@@ -25,6 +26,41 @@ void sleep_thread(u32 milliseconds)
   Sleep(milliseconds);
 }
 
+//---
+u32 get_processor_count()
+{
+  SYSTEM_INFO system_info;
+  GetSystemInfo(&system_info);
+  return system_info.dwNumberOfProcessors;
+}
+
+//---
+u32 get_current_processor()
+{
+  return GetCurrentProcessorNumber();
+}
+
+//---
+bool wait_on_address(volatile void* address,
+                     void* compare_address,
+                     u64 address_size,
+                     u32 timeout_ms)
+{
+  return WaitOnAddress(address, compare_address, address_size, timeout_ms);
+}
+
+//---
+void wake_by_address_single(void* address)
+{
+  WakeByAddressSingle(address);
+}
+
+//---
+void wake_by_address_all(void* address)
+{
+  WakeByAddressAll(address);
+}
+
 //---
 u64 get_callstack(utf8* string_out,
                   u64 string_capacity)